@@ -0,0 +1,248 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2025-Present Kevin Traini
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "bench_tools.h"
+#include "e2e_programs.h"
+
+#include <benchmark/benchmark.h>
+#include <filc/grammar/array/Array.h>
+#include <filc/grammar/assignation/Assignation.h>
+#include <filc/grammar/calcul/Calcul.h>
+#include <filc/grammar/identifier/Identifier.h>
+#include <filc/grammar/literal/Literal.h>
+#include <filc/grammar/pointer/Pointer.h>
+#include <filc/grammar/variable/Variable.h>
+#include <memory>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+static auto BM_ParseProgram(benchmark::State &state) -> void {
+    const auto content = generateCalculProgram(state.range(0));
+    for (auto _ : state) {
+        auto program = parseString(content);
+        benchmark::DoNotOptimize(program);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+BENCHMARK(BM_ParseProgram)->RangeMultiplier(4)->Range(1 << 8, 1 << 14)->Unit(benchmark::kMillisecond);
+
+// Release of a parsed program. Its nodes are not trivially destructible, so the arena still calls one destructor per
+// node before freeing its chunks: "destructor" is the teardown time per destructor called.
+static auto BM_TeardownProgram(benchmark::State &state) -> void {
+    const auto content = generateCalculProgram(state.range(0));
+    size_t destructors = 0;
+    for (auto _ : state) {
+        state.PauseTiming();
+        auto program = parseString(content);
+        destructors  = program->getArena().getDestructorCount();
+        state.ResumeTiming();
+        program.reset();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+    state.counters["destructors"] = static_cast<double>(destructors);
+    state.counters["destructor"]  = benchmark::Counter(
+        static_cast<double>(destructors), benchmark::Counter::kIsIterationInvariantRate | benchmark::Counter::kInvert
+    );
+}
+
+BENCHMARK(BM_TeardownProgram)->RangeMultiplier(4)->Range(1 << 8, 1 << 14)->Unit(benchmark::kMicrosecond);
+
+// Allocation and release of AST nodes, as done before the arena, with one shared_ptr per node
+static auto BM_NodesSharedPtr(benchmark::State &state) -> void {
+    for (auto _ : state) {
+        std::vector<std::shared_ptr<filc::Expression>> nodes;
+        nodes.reserve(2 * state.range(0));
+        for (int64_t i = 0; i < state.range(0); i++) {
+            nodes.push_back(std::make_shared<filc::IntegerLiteral>(static_cast<int>(i)));
+            nodes.push_back(std::make_shared<filc::Identifier>("value"));
+        }
+        benchmark::DoNotOptimize(nodes.data());
+    }
+    state.SetItemsProcessed(state.iterations() * 2 * state.range(0));
+}
+
+BENCHMARK(BM_NodesSharedPtr)->RangeMultiplier(8)->Range(1 << 8, 1 << 17);
+
+// Allocation and release of AST nodes in an arena, as done by the parser
+static auto BM_NodesArena(benchmark::State &state) -> void {
+    for (auto _ : state) {
+        filc::Arena arena;
+        std::vector<filc::Expression *> nodes;
+        nodes.reserve(2 * state.range(0));
+        for (int64_t i = 0; i < state.range(0); i++) {
+            nodes.push_back(arena.make<filc::IntegerLiteral>(static_cast<int>(i)));
+            nodes.push_back(arena.make<filc::Identifier>("value"));
+        }
+        benchmark::DoNotOptimize(nodes.data());
+    }
+    state.SetItemsProcessed(state.iterations() * 2 * state.range(0));
+}
+
+BENCHMARK(BM_NodesArena)->RangeMultiplier(8)->Range(1 << 8, 1 << 17);
+
+namespace {
+// Programs of the e2e tests, repeated `count` times
+auto generateE2ESources(const unsigned int count) -> std::string {
+    std::string content;
+    for (unsigned int i = 0; i < count; i++) {
+        for (const auto &[source, result] : allE2EPrograms()) {
+            content += std::string(source) + "\n";
+        }
+    }
+
+    return content;
+}
+
+struct ArenaNodes {
+    filc::Arena &arena;
+
+    template<typename T, typename... Args> auto make(Args &&...args) const -> T * {
+        return arena.make<T>(std::forward<Args>(args)...);
+    }
+};
+
+struct SharedPtrNodes {
+    std::vector<std::shared_ptr<filc::Expression>> &nodes;
+
+    template<typename T, typename... Args> auto make(Args &&...args) const -> T * {
+        const auto node = std::make_shared<T>(std::forward<Args>(args)...);
+        nodes.push_back(node);
+        return node.get();
+    }
+};
+
+// Allocate a copy of the tree of expression, node by node, in the order the parser creates them
+template<typename Nodes> auto rebuild(const filc::Expression *expression, const Nodes &nodes) -> filc::Expression * {
+    using namespace filc;
+    if (expression == nullptr) {
+        return nullptr;
+    }
+
+    switch (expression->getKind()) {
+        case ExpressionKind::BOOLEAN_LITERAL:
+            return nodes.template make<BooleanLiteral>(static_cast<const BooleanLiteral *>(expression)->getValue());
+        case ExpressionKind::INTEGER_LITERAL:
+            return nodes.template make<IntegerLiteral>(static_cast<const IntegerLiteral *>(expression)->getValue());
+        case ExpressionKind::FLOAT_LITERAL:
+            return nodes.template make<FloatLiteral>(static_cast<const FloatLiteral *>(expression)->getValue());
+        case ExpressionKind::CHARACTER_LITERAL:
+            return nodes.template make<CharacterLiteral>(static_cast<const CharacterLiteral *>(expression)->getValue());
+        case ExpressionKind::STRING_LITERAL:
+            return nodes.template make<StringLiteral>(static_cast<const StringLiteral *>(expression)->getValue());
+        case ExpressionKind::VARIABLE_DECLARATION: {
+            const auto variable = static_cast<const VariableDeclaration *>(expression);
+            return nodes.template make<VariableDeclaration>(
+                variable->isConstant(),
+                variable->getName(),
+                variable->getTypeName(),
+                rebuild(variable->getValue(), nodes)
+            );
+        }
+        case ExpressionKind::IDENTIFIER:
+            return nodes.template make<Identifier>(static_cast<const Identifier *>(expression)->getName());
+        case ExpressionKind::BINARY_CALCUL: {
+            const auto calcul = static_cast<const BinaryCalcul *>(expression);
+            const auto left   = rebuild(calcul->getLeftExpression(), nodes);
+            return nodes.template make<BinaryCalcul>(
+                left, calcul->getOperator(), rebuild(calcul->getRightExpression(), nodes)
+            );
+        }
+        case ExpressionKind::ASSIGNATION: {
+            const auto assignation = static_cast<const Assignation *>(expression);
+            return nodes.template make<Assignation>(
+                assignation->getIdentifier(), rebuild(assignation->getValue(), nodes)
+            );
+        }
+        case ExpressionKind::POINTER: {
+            const auto pointer = static_cast<const Pointer *>(expression);
+            return nodes.template make<Pointer>(pointer->getTypeName(), rebuild(pointer->getValue(), nodes));
+        }
+        case ExpressionKind::POINTER_DEREFERENCING:
+            return nodes.template make<PointerDereferencing>(
+                rebuild(static_cast<const PointerDereferencing *>(expression)->getPointer(), nodes)
+            );
+        case ExpressionKind::VARIABLE_ADDRESS:
+            return nodes.template make<VariableAddress>(
+                rebuild(static_cast<const VariableAddress *>(expression)->getVariable(), nodes)
+            );
+        case ExpressionKind::ARRAY: {
+            std::vector<Expression *> values;
+            for (const auto value : static_cast<const Array *>(expression)->getValues()) {
+                values.push_back(rebuild(value, nodes));
+            }
+            return nodes.template make<Array>(std::move(values));
+        }
+        case ExpressionKind::ARRAY_ACCESS: {
+            const auto array_access = static_cast<const ArrayAccess *>(expression);
+            return nodes.template make<ArrayAccess>(rebuild(array_access->getArray(), nodes), array_access->getIndex());
+        }
+    }
+
+    throw std::logic_error("Unknown expression kind");
+}
+} // namespace
+
+// Parsing and release of the e2e programs, with the tree in the program arena
+static auto BM_ParseTeardownSources(benchmark::State &state) -> void {
+    const auto content = generateE2ESources(state.range(0));
+    for (auto _ : state) {
+        auto program = parseString(content);
+        benchmark::DoNotOptimize(program);
+        program.reset();
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * content.size()));
+}
+
+BENCHMARK(BM_ParseTeardownSources)->RangeMultiplier(8)->Range(1, 1 << 9)->Unit(benchmark::kMillisecond);
+
+// The parser used to allocate each node of these programs with make_shared. Lexing and parsing cost the same with
+// both trees, so only their nodes are built and released here, copied from the parsed programs.
+static auto BM_SourcesTreeSharedPtr(benchmark::State &state) -> void {
+    const auto program = parseString(generateE2ESources(state.range(0)));
+    for (auto _ : state) {
+        std::vector<std::shared_ptr<filc::Expression>> nodes;
+        const SharedPtrNodes allocator {nodes};
+        for (const auto expression : program->getExpressions()) {
+            benchmark::DoNotOptimize(rebuild(expression, allocator));
+        }
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * program->getArena().getObjectCount()));
+}
+
+BENCHMARK(BM_SourcesTreeSharedPtr)->RangeMultiplier(8)->Range(1, 1 << 9);
+
+static auto BM_SourcesTreeArena(benchmark::State &state) -> void {
+    const auto program = parseString(generateE2ESources(state.range(0)));
+    for (auto _ : state) {
+        filc::Arena arena;
+        const ArenaNodes allocator {arena};
+        for (const auto expression : program->getExpressions()) {
+            benchmark::DoNotOptimize(rebuild(expression, allocator));
+        }
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * program->getArena().getObjectCount()));
+}
+
+BENCHMARK(BM_SourcesTreeArena)->RangeMultiplier(8)->Range(1, 1 << 9);
@@ -0,0 +1,159 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2025-Present Kevin Traini
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "bench_tools.h"
+
+#include "FilLexer.h"
+#include "FilParser.h"
+#include "antlr4-runtime.h"
+
+#include <filesystem>
+#include <fstream>
+
+auto parseString(const std::string &content) -> std::shared_ptr<filc::Program> {
+    antlr4::ANTLRInputStream input(content);
+    filc::FilLexer lexer(&input);
+    antlr4::CommonTokenStream tokens(&lexer);
+    tokens.fill();
+
+    filc::FilParser parser(&tokens);
+
+    return parser.program()->tree;
+}
+
+auto generateCalculProgram(const unsigned int count) -> std::string {
+    std::string content;
+    for (unsigned int i = 0; i < count; i++) {
+        const auto index = std::to_string(i);
+        content          += "val value_" + index + " = " + index + " + 2 * 3 - " + index + " % 7\n";
+    }
+    content += "0\n";
+
+    return content;
+}
+
+auto generateNestedProgram(const unsigned int depth) -> std::string {
+    std::string content = "val value = ";
+    for (unsigned int i = 0; i < depth; i++) {
+        content += "(" + std::to_string(i % 10) + " + ";
+    }
+    content += "1" + std::string(depth, ')') + "\n0\n";
+
+    return content;
+}
+
+auto generateLongExpressionProgram(const unsigned int length) -> std::string {
+    const std::vector<std::string> operators = {" + ", " * ", " - ", " / ", " % "};
+    std::string content                      = "val value = 1";
+    for (unsigned int i = 0; i < length; i++) {
+        const auto operand = std::to_string(i % 9 + 1);
+        content            += operators[i % operators.size()] + (i % 3 == 0 ? "[" + operand + ", 1][0]" : operand);
+    }
+    content += "\n0\n";
+
+    return content;
+}
+
+auto generateDeclarationProgram(const unsigned int count) -> std::string {
+    std::string content;
+    for (unsigned int i = 0; i < count; i++) {
+        const auto index = std::to_string(i);
+        content          += "var value_" + index + ": i32 = " + index + "\n";
+    }
+    content += "0\n";
+
+    return content;
+}
+
+auto generateArrayProgram(const unsigned int size) -> std::string {
+    std::string content = "val values = [";
+    for (unsigned int i = 0; i < size; i++) {
+        content += (i > 0 ? ", " : "") + std::to_string(i);
+    }
+    content += "]\n0\n";
+
+    return content;
+}
+
+auto generateVariableArrayProgram(const unsigned int size) -> std::string {
+    std::string content = "val first = 0\nval values = [first";
+    for (unsigned int i = 1; i < size; i++) {
+        content += ", " + std::to_string(i);
+    }
+    content += "]\n0\n";
+
+    return content;
+}
+
+auto generateStringProgram(const unsigned int length) -> std::string {
+    std::string value;
+    for (unsigned int i = 0; i < length; i++) {
+        value += static_cast<char>('a' + i % 26);
+    }
+
+    std::string content;
+    for (unsigned int i = 0; i < 16; i++) {
+        content += "val text_" + std::to_string(i) + " = \"" + value + "\"\n";
+    }
+    content += "0\n";
+
+    return content;
+}
+
+auto writeProgram(const std::string &name, const std::string &content) -> std::string {
+    const auto directory = std::filesystem::temp_directory_path() / name;
+    std::filesystem::remove_all(directory);
+    std::filesystem::create_directories(directory);
+
+    const auto file = directory / "main.fil";
+    std::ofstream(file) << content;
+
+    return file.string();
+}
+
+auto generateCorpus(const std::string &name, const unsigned int file_count, const unsigned int calcul_count)
+    -> std::vector<std::string> {
+    const auto directory = std::filesystem::temp_directory_path() / name;
+    std::filesystem::remove_all(directory);
+    std::filesystem::create_directories(directory);
+
+    const auto content = generateCalculProgram(calcul_count);
+    std::vector<std::string> files;
+    for (unsigned int i = 0; i < file_count; i++) {
+        const auto file = directory / ("file_" + std::to_string(i) + ".fil");
+        std::ofstream(file) << content;
+        files.push_back(file.string());
+    }
+
+    return files;
+}
+
+auto toStringArray(const std::vector<std::string> &data) -> std::vector<char *> {
+    std::vector<char *> strings;
+    strings.reserve(data.size());
+    for (auto &item : data) {
+        strings.push_back(const_cast<char *>(item.c_str()));
+    }
+
+    return strings;
+}
@@ -0,0 +1,83 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2025-Present Kevin Traini
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef FILC_BENCH_TOOLS_H
+#define FILC_BENCH_TOOLS_H
+
+#include <filc/grammar/program/Program.h>
+#include <memory>
+#include <string>
+#include <vector>
+
+auto parseString(const std::string &content) -> std::shared_ptr<filc::Program>;
+
+/**
+ * Generate a valid program made of `count` variable declarations, each one holding a small calcul
+ */
+auto generateCalculProgram(unsigned int count) -> std::string;
+
+/**
+ * Generate a valid program declaring one value computed by an expression nested `depth` parentheses deep
+ */
+auto generateNestedProgram(unsigned int depth) -> std::string;
+
+/**
+ * Generate a valid program declaring one value computed by a flat expression of `length` binary operations,
+ * mixing every arithmetic operator and array accesses
+ */
+auto generateLongExpressionProgram(unsigned int length) -> std::string;
+
+/**
+ * Generate a valid program made of `count` typed variable declarations
+ */
+auto generateDeclarationProgram(unsigned int count) -> std::string;
+
+/**
+ * Generate a valid program declaring an array literal of `size` integers
+ */
+auto generateArrayProgram(unsigned int size) -> std::string;
+
+/**
+ * Same as generateArrayProgram, but the first value is a variable so that the array is not a constant
+ */
+auto generateVariableArrayProgram(unsigned int size) -> std::string;
+
+/**
+ * Generate a valid program declaring 16 string literals of `length` characters each
+ */
+auto generateStringProgram(unsigned int length) -> std::string;
+
+/**
+ * Write content into a file of a fresh temporary directory and return its path
+ */
+auto writeProgram(const std::string &name, const std::string &content) -> std::string;
+
+/**
+ * Write `file_count` programs generated by generateCalculProgram(calcul_count) into a fresh temporary directory
+ */
+auto generateCorpus(const std::string &name, unsigned int file_count, unsigned int calcul_count)
+    -> std::vector<std::string>;
+
+auto toStringArray(const std::vector<std::string> &data) -> std::vector<char *>;
+
+#endif // FILC_BENCH_TOOLS_H
@@ -0,0 +1,133 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2025-Present Kevin Traini
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "bench_tools.h"
+
+#include <algorithm>
+#include <benchmark/benchmark.h>
+#include <filc/llvm/IRGenerator.h>
+#include <filc/validation/CalculValidator.h>
+#include <filc/validation/ValidationVisitor.h>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace {
+const std::vector<filc::BinaryOperator> OPERATORS = {
+  filc::BinaryOperator::PLUS,
+  filc::BinaryOperator::STAR,
+  filc::BinaryOperator::MINUS,
+  filc::BinaryOperator::MOD,
+  filc::BinaryOperator::LT,
+  filc::BinaryOperator::EQEQ,
+};
+
+const std::vector<std::string> TYPE_NAMES = {"i32", "u64", "f64", "bool"};
+
+// Operator classification as done before the dispatch table: name lists built and searched for each node
+auto isCalculValidByName(const std::string &left_name, const std::string &op, const std::string &right_name) -> bool {
+    const std::vector<std::string> numeric_type
+        = {"i8", "i16", "i32", "i64", "i128", "u8", "u16", "u32", "u64", "u128", "f32", "f64"};
+    if (std::find(numeric_type.begin(), numeric_type.end(), left_name) != numeric_type.end()
+        && left_name == right_name) {
+        const std::vector<std::string> numeric_op = {"%", "+", "-", "/", "*"};
+        const std::vector<std::string> boolean_op = {"<", "<=", ">", ">=", "==", "!="};
+        return std::find(numeric_op.begin(), numeric_op.end(), op) != numeric_op.end()
+            || std::find(boolean_op.begin(), boolean_op.end(), op) != boolean_op.end();
+    }
+
+    if (left_name == "bool" && left_name == right_name) {
+        return op == "&&" || op == "||" || op == "==" || op == "!=";
+    }
+
+    return false;
+}
+} // namespace
+
+static auto BM_CalculValidatorByName(benchmark::State &state) -> void {
+    filc::Environment environment;
+    std::vector<std::shared_ptr<filc::AbstractType>> types;
+    for (const auto &name : TYPE_NAMES) {
+        types.push_back(environment.getType(name));
+    }
+
+    for (auto _ : state) {
+        for (const auto &type : types) {
+            for (const auto op : OPERATORS) {
+                benchmark::DoNotOptimize(isCalculValidByName(type->getName(), filc::toString(op), type->getName()));
+            }
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * types.size() * OPERATORS.size());
+}
+
+BENCHMARK(BM_CalculValidatorByName);
+
+static auto BM_CalculValidatorTable(benchmark::State &state) -> void {
+    filc::Environment environment;
+    const filc::CalculValidator validator(&environment);
+    std::vector<std::shared_ptr<filc::AbstractType>> types;
+    for (const auto &name : TYPE_NAMES) {
+        types.push_back(environment.getType(name));
+    }
+
+    for (auto _ : state) {
+        for (const auto &type : types) {
+            for (const auto op : OPERATORS) {
+                benchmark::DoNotOptimize(validator.isCalculValid(type, op, type));
+            }
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * types.size() * OPERATORS.size());
+}
+
+BENCHMARK(BM_CalculValidatorTable);
+
+static auto BM_ValidateCalculProgram(benchmark::State &state) -> void {
+    const auto program = parseString(generateCalculProgram(state.range(0)));
+    for (auto _ : state) {
+        std::stringstream out;
+        filc::ValidationVisitor visitor(out);
+        program->acceptVoidVisitor(&visitor);
+        benchmark::DoNotOptimize(visitor.hasError());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+BENCHMARK(BM_ValidateCalculProgram)->RangeMultiplier(4)->Range(1 << 8, 1 << 14)->Unit(benchmark::kMillisecond);
+
+static auto BM_GenerateCalculIR(benchmark::State &state) -> void {
+    const auto program = parseString(generateCalculProgram(state.range(0)));
+    std::stringstream out;
+    filc::ValidationVisitor visitor(out);
+    program->acceptVoidVisitor(&visitor);
+
+    for (auto _ : state) {
+        filc::IRGenerator generator("benchmark", visitor.getEnvironment());
+        program->acceptIRVisitor(&generator);
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+BENCHMARK(BM_GenerateCalculIR)->RangeMultiplier(4)->Range(1 << 8, 1 << 14)->Unit(benchmark::kMillisecond);
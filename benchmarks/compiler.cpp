@@ -0,0 +1,47 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2025-Present Kevin Traini
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "bench_tools.h"
+
+#include <benchmark/benchmark.h>
+#include <filc/filc.h>
+#include <sstream>
+#include <string>
+#include <vector>
+
+// Whole frontend + object emission over a synthetic multi-file corpus, with an increasing number of jobs
+static auto BM_CompileCorpus(benchmark::State &state) -> void {
+    static const auto files = generateCorpus("filc_bench_corpus", 32, 200);
+
+    std::vector<std::string> arguments = {"filc", "--emit=obj", "-j", std::to_string(state.range(0))};
+    arguments.insert(arguments.end(), files.begin(), files.end());
+
+    for (auto _ : state) {
+        std::stringstream out;
+        auto compiler = filc::FilCompiler(filc::OptionsParser(), out);
+        benchmark::DoNotOptimize(compiler.run(static_cast<int>(arguments.size()), toStringArray(arguments).data()));
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * files.size()));
+}
+
+BENCHMARK(BM_CompileCorpus)->Arg(1)->Arg(2)->Arg(4)->Arg(8)->Unit(benchmark::kMillisecond)->UseRealTime();
@@ -0,0 +1,116 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2025-Present Kevin Traini
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "bench_tools.h"
+
+#include "FilLexer.h"
+#include "FilParser.h"
+#include "antlr4-runtime.h"
+
+#include <benchmark/benchmark.h>
+#include <filc/grammar/Parser.h>
+#include <filc/grammar/SourceStream.h>
+#include <filc/utils/SourceManager.h>
+
+// Parsing of deep and long expressions, where adaptive prediction of the left-recursive expression rule is the most
+// expensive: full LL prediction only, as done before, against SLL prediction falling back to LL.
+// Then parsing of large array literals, as found in generated lookup tables.
+
+namespace {
+using Generator = std::string (*)(unsigned int);
+
+auto parseFullContext(const std::string &file) -> std::shared_ptr<filc::Program> {
+    filc::SourceManager sources;
+    const auto source = sources.load(file);
+    filc::SourceStream input(source);
+    filc::FilLexer lexer(&input);
+    antlr4::CommonTokenStream tokens(&lexer);
+    tokens.fill();
+
+    filc::FilParser parser(&tokens);
+
+    return parser.program()->tree;
+}
+} // namespace
+
+static auto BM_ParseExpressionLL(benchmark::State &state, const Generator generator) -> void {
+    const auto content = generator(state.range(0));
+    const auto file    = writeProgram("filc_bench_parser", content);
+    for (auto _ : state) {
+        auto program = parseFullContext(file);
+        benchmark::DoNotOptimize(program);
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * content.size()));
+}
+
+static auto BM_ParseExpressionSLLFirst(benchmark::State &state, const Generator generator) -> void {
+    const auto content = generator(state.range(0));
+    const auto file    = writeProgram("filc_bench_parser", content);
+
+    const auto full_context_parses = filc::ParserProxy::getFullContextParseCount();
+    for (auto _ : state) {
+        filc::SourceManager sources;
+        auto program = filc::ParserProxy::parse(file, sources);
+        benchmark::DoNotOptimize(program);
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * content.size()));
+    const auto fallbacks = filc::ParserProxy::getFullContextParseCount() - full_context_parses;
+    state.counters["full_context_parses"]
+        = benchmark::Counter(static_cast<double>(fallbacks), benchmark::Counter::kAvgIterations);
+}
+
+BENCHMARK_CAPTURE(BM_ParseExpressionLL, nested, generateNestedProgram)
+    ->RangeMultiplier(4)
+    ->Range(1 << 4, 1 << 10)
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(BM_ParseExpressionSLLFirst, nested, generateNestedProgram)
+    ->RangeMultiplier(4)
+    ->Range(1 << 4, 1 << 10)
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(BM_ParseExpressionLL, long, generateLongExpressionProgram)
+    ->RangeMultiplier(4)
+    ->Range(1 << 6, 1 << 12)
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(BM_ParseExpressionSLLFirst, long, generateLongExpressionProgram)
+    ->RangeMultiplier(4)
+    ->Range(1 << 6, 1 << 12)
+    ->Unit(benchmark::kMillisecond);
+
+static auto BM_ParseArrayLiteral(benchmark::State &state) -> void {
+    const auto content = generateArrayProgram(state.range(0));
+    const auto file    = writeProgram("filc_bench_parser", content);
+    for (auto _ : state) {
+        filc::SourceManager sources;
+        auto program = filc::ParserProxy::parse(file, sources);
+        benchmark::DoNotOptimize(program);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+    state.SetComplexityN(state.range(0));
+}
+
+// Complexity should be reported as O(N)
+BENCHMARK(BM_ParseArrayLiteral)
+    ->RangeMultiplier(4)
+    ->Range(1 << 10, 1 << 20)
+    ->Unit(benchmark::kMillisecond)
+    ->Complexity(benchmark::oN);
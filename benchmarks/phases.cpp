@@ -0,0 +1,188 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2025-Present Kevin Traini
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "bench_tools.h"
+
+#include <benchmark/benchmark.h>
+#include <filc/filc.h>
+#include <filc/grammar/Parser.h>
+#include <filc/llvm/IRGenerator.h>
+#include <filc/utils/Diagnostics.h>
+#include <filc/utils/SourceManager.h>
+#include <filc/validation/ValidationVisitor.h>
+#include <filesystem>
+#include <sstream>
+#include <string>
+#include <vector>
+
+// Each phase of the compiler, in isolation and end to end, over programs of several shapes.
+// Run with --benchmark_out=<file> --benchmark_out_format=json to get results comparable between filc versions.
+
+namespace {
+using Generator = std::string (*)(unsigned int);
+
+struct Shape {
+    const char *name;
+    Generator generator;
+    int64_t min_size;
+    int64_t max_size;
+};
+
+const std::vector<Shape> SHAPES = {
+    {"calcul", generateCalculProgram, 1 << 6, 1 << 12},
+    {"nested", generateNestedProgram, 1 << 4, 1 << 10},
+    {"declarations", generateDeclarationProgram, 1 << 6, 1 << 12},
+    {"array", generateArrayProgram, 1 << 6, 1 << 16},
+    {"array_variable", generateVariableArrayProgram, 1 << 6, 1 << 16},
+    {"strings", generateStringProgram, 1 << 8, 1 << 16},
+};
+
+// The program of each benchmark is parsed and validated once, outside of the timed loop
+struct ValidatedProgram {
+    std::string file;
+    filc::SourceManager sources;
+    std::shared_ptr<filc::Program> program;
+    std::stringstream diagnostics_output;
+    filc::Diagnostics diagnostics;
+    filc::ValidationVisitor validation_visitor;
+
+    explicit ValidatedProgram(const std::string &content)
+        : file(writeProgram("filc_bench_phases", content)), program(filc::ParserProxy::parse(file, sources)),
+          diagnostics(diagnostics_output), validation_visitor(diagnostics) {
+        program->acceptVoidVisitor(&validation_visitor);
+    }
+};
+
+auto setProcessed(benchmark::State &state, const std::string &content) -> void {
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * content.size()));
+    state.counters["size"] = static_cast<double>(state.range(0));
+}
+} // namespace
+
+static auto BM_Parse(benchmark::State &state, const Generator generator) -> void {
+    const auto content = generator(state.range(0));
+    const auto file    = writeProgram("filc_bench_phases", content);
+    for (auto _ : state) {
+        filc::SourceManager sources;
+        auto program = filc::ParserProxy::parse(file, sources);
+        benchmark::DoNotOptimize(program);
+    }
+    setProcessed(state, content);
+}
+
+static auto BM_Validation(benchmark::State &state, const Generator generator) -> void {
+    const auto content = generator(state.range(0));
+    const ValidatedProgram validated(content);
+    if (validated.validation_visitor.hasError()) {
+        state.SkipWithError("Generated program is not valid");
+        return;
+    }
+
+    for (auto _ : state) {
+        std::stringstream output;
+        filc::Diagnostics diagnostics(output);
+        filc::ValidationVisitor validation_visitor(diagnostics);
+        validated.program->acceptVoidVisitor(&validation_visitor);
+        auto has_error = validation_visitor.hasError();
+        benchmark::DoNotOptimize(has_error);
+    }
+    setProcessed(state, content);
+}
+
+static auto BM_IRGeneration(benchmark::State &state, const Generator generator) -> void {
+    const auto content = generator(state.range(0));
+    const ValidatedProgram validated(content);
+    if (validated.validation_visitor.hasError()) {
+        state.SkipWithError("Generated program is not valid");
+        return;
+    }
+
+    for (auto _ : state) {
+        filc::IRGenerator ir_generator(validated.file, validated.validation_visitor.getEnvironment());
+        validated.program->acceptIRVisitor(&ir_generator);
+        benchmark::ClobberMemory();
+    }
+    setProcessed(state, content);
+}
+
+static auto BM_ToTarget(benchmark::State &state, const Generator generator) -> void {
+    const auto content = generator(state.range(0));
+    const ValidatedProgram validated(content);
+    if (validated.validation_visitor.hasError()) {
+        state.SkipWithError("Generated program is not valid");
+        return;
+    }
+
+    const auto output_file = std::filesystem::path(validated.file).replace_extension(".o").string();
+    for (auto _ : state) {
+        state.PauseTiming();
+        filc::IRGenerator ir_generator(validated.file, validated.validation_visitor.getEnvironment());
+        validated.program->acceptIRVisitor(&ir_generator);
+        if (ir_generator.setupTarget("", "", "", "0") != 0) {
+            state.SkipWithError("Could not set up the host target");
+            break;
+        }
+        state.ResumeTiming();
+
+        auto status = ir_generator.toTarget(output_file, "obj");
+        benchmark::DoNotOptimize(status);
+    }
+    setProcessed(state, content);
+    if (std::filesystem::exists(output_file)) {
+        state.counters["object_bytes"] = static_cast<double>(std::filesystem::file_size(output_file));
+    }
+}
+
+static auto BM_EndToEnd(benchmark::State &state, const Generator generator) -> void {
+    const auto content = generator(state.range(0));
+    const auto file    = writeProgram("filc_bench_phases", content);
+    const std::vector<std::string> arguments
+        = {"filc", "--emit=obj", "-o", std::filesystem::path(file).replace_extension(".o").string(), file};
+
+    for (auto _ : state) {
+        std::stringstream out;
+        auto compiler = filc::FilCompiler(filc::OptionsParser(), out);
+        auto status = compiler.run(static_cast<int>(arguments.size()), toStringArray(arguments).data());
+        benchmark::DoNotOptimize(status);
+    }
+    setProcessed(state, content);
+}
+
+template<typename Function> static auto registerPhase(const std::string &phase, Function function) -> bool {
+    for (const auto &shape : SHAPES) {
+        benchmark::RegisterBenchmark((phase + "/" + shape.name).c_str(), function, shape.generator)
+            ->RangeMultiplier(4)
+            ->Range(shape.min_size, shape.max_size)
+            ->Unit(benchmark::kMillisecond);
+    }
+
+    return true;
+}
+
+[[maybe_unused]] static const auto registered = [] {
+    benchmark::AddCustomContext("filc_version", FILC_VERSION);
+
+    return registerPhase("BM_Parse", BM_Parse) && registerPhase("BM_Validation", BM_Validation)
+        && registerPhase("BM_IRGeneration", BM_IRGeneration) && registerPhase("BM_ToTarget", BM_ToTarget)
+        && registerPhase("BM_EndToEnd", BM_EndToEnd);
+}();
@@ -0,0 +1,55 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2025-Present Kevin Traini
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "bench_tools.h"
+
+#include <benchmark/benchmark.h>
+#include <cstdlib>
+#include <filesystem>
+#include <string>
+
+// Whole process runs of the filc executable: --version measures the bare start up, the trivial compile adds the
+// target initialization and code generation of a program with a single expression
+static auto runFilc(benchmark::State &state, const std::string &arguments) -> void {
+    const auto command = std::string(FILC_BIN " ") + arguments + " > /dev/null";
+    for (auto _ : state) {
+        if (std::system(command.c_str()) != 0) {
+            state.SkipWithError("filc failed");
+            break;
+        }
+    }
+}
+
+static auto BM_StartupVersion(benchmark::State &state) -> void {
+    runFilc(state, "--version");
+}
+
+BENCHMARK(BM_StartupVersion)->Unit(benchmark::kMillisecond)->UseRealTime();
+
+static auto BM_StartupTrivialCompile(benchmark::State &state) -> void {
+    const auto file   = generateCorpus("filc_bench_startup", 1, 0).front();
+    const auto output = std::filesystem::path(file).replace_extension(".o").string();
+    runFilc(state, "--emit=obj -o " + output + " " + file);
+}
+
+BENCHMARK(BM_StartupTrivialCompile)->Unit(benchmark::kMillisecond)->UseRealTime();
@@ -0,0 +1,176 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2025-Present Kevin Traini
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "bench_tools.h"
+
+#include <any>
+#include <benchmark/benchmark.h>
+#include <filc/grammar/Dispatch.h>
+#include <filc/grammar/Visitor.h>
+#include <map>
+#include <stack>
+#include <string>
+
+namespace {
+// Walks the whole tree, either through accept*Visitor virtual double dispatch or through dispatch()
+template<bool StaticDispatch> class NodeCounter final : public filc::Visitor<void> {
+  public:
+    unsigned long count = 0;
+
+    auto visitProgram(filc::Program *program) -> void override {
+        for (const auto expression : program->getExpressions()) {
+            visitChild(expression);
+        }
+    }
+
+    auto visitBooleanLiteral(filc::BooleanLiteral *literal) -> void override {
+        count++;
+    }
+
+    auto visitIntegerLiteral(filc::IntegerLiteral *literal) -> void override {
+        count++;
+    }
+
+    auto visitFloatLiteral(filc::FloatLiteral *literal) -> void override {
+        count++;
+    }
+
+    auto visitCharacterLiteral(filc::CharacterLiteral *literal) -> void override {
+        count++;
+    }
+
+    auto visitStringLiteral(filc::StringLiteral *literal) -> void override {
+        count++;
+    }
+
+    auto visitVariableDeclaration(filc::VariableDeclaration *variable) -> void override {
+        count++;
+        if (variable->getValue() != nullptr) {
+            visitChild(variable->getValue());
+        }
+    }
+
+    auto visitIdentifier(filc::Identifier *identifier) -> void override {
+        count++;
+    }
+
+    auto visitBinaryCalcul(filc::BinaryCalcul *calcul) -> void override {
+        count++;
+        visitChild(calcul->getLeftExpression());
+        visitChild(calcul->getRightExpression());
+    }
+
+    auto visitAssignation(filc::Assignation *assignation) -> void override {
+        count++;
+        visitChild(assignation->getValue());
+    }
+
+    auto visitPointer(filc::Pointer *pointer) -> void override {
+        count++;
+        visitChild(pointer->getValue());
+    }
+
+    auto visitPointerDereferencing(filc::PointerDereferencing *pointer) -> void override {
+        count++;
+        visitChild(pointer->getPointer());
+    }
+
+    auto visitVariableAddress(filc::VariableAddress *address) -> void override {
+        count++;
+        visitChild(address->getVariable());
+    }
+
+    auto visitArray(filc::Array *array) -> void override {
+        count++;
+        for (const auto value : array->getValues()) {
+            visitChild(value);
+        }
+    }
+
+    auto visitArrayAccess(filc::ArrayAccess *array_access) -> void override {
+        count++;
+        visitChild(array_access->getArray());
+    }
+
+  private:
+    auto visitChild(filc::Expression *expression) -> void {
+        if constexpr (StaticDispatch) {
+            filc::dispatch(this, expression);
+        } else {
+            expression->acceptVoidVisitor(this);
+        }
+    }
+};
+
+struct Frame {
+    bool return_used = false;
+    void *cast_type  = nullptr;
+};
+} // namespace
+
+template<bool StaticDispatch> static auto BM_Traversal(benchmark::State &state) -> void {
+    const auto program = parseString(generateCalculProgram(state.range(0)));
+    unsigned long nodes = 0;
+    for (auto _ : state) {
+        NodeCounter<StaticDispatch> counter;
+        program->acceptVoidVisitor(&counter);
+        nodes = counter.count;
+        benchmark::DoNotOptimize(nodes);
+    }
+    state.SetItemsProcessed(state.iterations() * nodes);
+}
+
+BENCHMARK_TEMPLATE(BM_Traversal, false)->Name("BM_TraversalVirtual")->RangeMultiplier(8)->Range(1 << 8, 1 << 14);
+BENCHMARK_TEMPLATE(BM_Traversal, true)->Name("BM_TraversalDispatch")->RangeMultiplier(8)->Range(1 << 8, 1 << 14);
+
+// Per node context handling as done before the typed context: one map per frame, string keys and std::any values
+static auto BM_ContextAnyMap(benchmark::State &state) -> void {
+    std::stack<std::map<std::string, std::any>> context;
+    context.emplace();
+    for (auto _ : state) {
+        context.emplace();
+        context.top()["return"]    = true;
+        context.top()["cast_type"] = static_cast<void *>(nullptr);
+        const auto used            = context.top().find("return") != context.top().end()
+                     && std::any_cast<bool>(context.top().at("return"));
+        benchmark::DoNotOptimize(used);
+        context.pop();
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+BENCHMARK(BM_ContextAnyMap);
+
+static auto BM_ContextTyped(benchmark::State &state) -> void {
+    filc::VisitorContext<Frame> context;
+    for (auto _ : state) {
+        auto &frame       = context.stack();
+        frame.return_used = true;
+        frame.cast_type   = nullptr;
+        benchmark::DoNotOptimize(context.top().return_used);
+        context.unstack();
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+BENCHMARK(BM_ContextTyped);
@@ -0,0 +1,77 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2025-Present Kevin Traini
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef FILC_OBJECTCACHE_H
+#define FILC_OBJECTCACHE_H
+
+#include <atomic>
+#include <cstdint>
+#include <ostream>
+#include <string>
+#include <vector>
+
+namespace filc {
+/**
+ * On-disk cache of compilation outputs, addressed by a hash of the source and of everything influencing its
+ * compilation. Entries are evicted in least recently used order once the cache grows over its maximum size.
+ */
+class ObjectCache final {
+  public:
+    ObjectCache(std::string directory, std::uintmax_t max_size);
+
+    [[nodiscard]] static auto computeKey(const std::string &source, const std::vector<std::string> &options)
+        -> std::string;
+
+    /**
+     * Copy the entry of key to output_file and read the diagnostics stored with it, returns false if there is no
+     * such entry
+     */
+    [[nodiscard]] auto fetch(const std::string &key, const std::string &output_file, std::string &diagnostics)
+        -> bool;
+
+    auto store(const std::string &key, const std::string &output_file, const std::string &diagnostics) -> void;
+
+    /**
+     * Add this run hits and misses to the persisted statistics and evict entries over the size limit
+     */
+    auto flush() -> void;
+
+    [[nodiscard]] auto getHits() const -> unsigned long;
+
+    [[nodiscard]] auto getMisses() const -> unsigned long;
+
+    auto showStatistics(std::ostream &out) const -> void;
+
+  private:
+    std::string _directory;
+    std::uintmax_t _max_size;
+    std::atomic<unsigned long> _hits;
+    std::atomic<unsigned long> _misses;
+
+    [[nodiscard]] auto getEntryPath(const std::string &key) const -> std::string;
+
+    [[nodiscard]] auto getDiagnosticsPath(const std::string &key) const -> std::string;
+};
+}
+
+#endif // FILC_OBJECTCACHE_H
@@ -24,21 +24,77 @@
 #ifndef FILC_FILC_H
 #define FILC_FILC_H
 
+#include "filc/cache/ObjectCache.h"
 #include "filc/options/OptionsParser.h"
-#include "filc/grammar/DumpVisitor.h"
-#include "filc/validation/ValidationVisitor.h"
+#include "filc/utils/Diagnostics.h"
+#include "filc/utils/TimeReport.h"
+#include <filesystem>
+#include <iostream>
+#include <memory>
+#include <ostream>
+#include <string>
 
 namespace filc {
 class FilCompiler final {
   public:
-    FilCompiler(OptionsParser options_parser, DumpVisitor ast_dump_visitor, ValidationVisitor validation_visitor);
+    /**
+     * Relative paths given on the command line are resolved against base_directory when it is not empty, and
+     * against the current directory otherwise.
+     */
+    FilCompiler(
+        OptionsParser options_parser,
+        std::ostream &out,
+        std::ostream &err                    = std::cerr,
+        std::filesystem::path base_directory = {}
+    );
 
+    /**
+     * Compile all files given on the command line. When there are several of them, they are compiled concurrently
+     * and each one is written next to its source file (a.fil -> a, a.o, a.s, a.bc or a.ll depending on --emit),
+     * so -o is rejected.
+     */
     auto run(int argc, char **argv) -> int;
 
   private:
     OptionsParser _options_parser;
-    DumpVisitor _ast_dump_visitor;
-    ValidationVisitor _validation_visitor;
+    std::ostream &_out;
+    std::ostream &_err;
+    std::filesystem::path _base_directory;
+    std::unique_ptr<ObjectCache> _cache;
+
+    [[nodiscard]] auto compile(
+        const std::string &filename,
+        const std::string &output_file,
+        std::ostream &out,
+        std::ostream &err,
+        Diagnostics &diagnostics
+    ) const -> int;
+
+    /**
+     * Phases are timed in time_report when it is not nullptr
+     */
+    [[nodiscard]] auto compile(
+        const std::string &filename,
+        const std::string &output_file,
+        std::ostream &out,
+        std::ostream &err,
+        Diagnostics &diagnostics,
+        TimeReport *time_report
+    ) const -> int;
+
+    /**
+     * Diagnostics writing to out, set up from the warning options
+     */
+    [[nodiscard]] auto makeDiagnostics(std::ostream &out) const -> Diagnostics;
+
+    [[nodiscard]] auto resolvePath(const std::string &path) const -> std::string;
+
+    /**
+     * Empty when the target options are invalid, the compilation is then not cached
+     */
+    [[nodiscard]] auto computeCacheKey(const std::string &filename) const -> std::string;
+
+    [[nodiscard]] static auto getOutputFile(const std::string &filename, const std::string &emit) -> std::string;
 };
 } // namespace filc
 
@@ -0,0 +1,79 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2025-Present Kevin Traini
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef FILC_DISPATCH_H
+#define FILC_DISPATCH_H
+
+#include "filc/grammar/array/Array.h"
+#include "filc/grammar/assignation/Assignation.h"
+#include "filc/grammar/calcul/Calcul.h"
+#include "filc/grammar/expression/Expression.h"
+#include "filc/grammar/identifier/Identifier.h"
+#include "filc/grammar/literal/Literal.h"
+#include "filc/grammar/pointer/Pointer.h"
+#include "filc/grammar/variable/Variable.h"
+
+#include <stdexcept>
+
+namespace filc {
+/**
+ * Call the visit method of visitor matching the kind of expression.
+ * When the visitor class is final, the call is resolved at compile time, without going through accept*Visitor.
+ */
+template<typename ConcreteVisitor>
+auto dispatch(ConcreteVisitor *visitor, Expression *expression) -> decltype(visitor->visitIdentifier(nullptr)) {
+    switch (expression->getKind()) {
+        case ExpressionKind::BOOLEAN_LITERAL:
+            return visitor->visitBooleanLiteral(static_cast<BooleanLiteral *>(expression));
+        case ExpressionKind::INTEGER_LITERAL:
+            return visitor->visitIntegerLiteral(static_cast<IntegerLiteral *>(expression));
+        case ExpressionKind::FLOAT_LITERAL:
+            return visitor->visitFloatLiteral(static_cast<FloatLiteral *>(expression));
+        case ExpressionKind::CHARACTER_LITERAL:
+            return visitor->visitCharacterLiteral(static_cast<CharacterLiteral *>(expression));
+        case ExpressionKind::STRING_LITERAL:
+            return visitor->visitStringLiteral(static_cast<StringLiteral *>(expression));
+        case ExpressionKind::VARIABLE_DECLARATION:
+            return visitor->visitVariableDeclaration(static_cast<VariableDeclaration *>(expression));
+        case ExpressionKind::IDENTIFIER:
+            return visitor->visitIdentifier(static_cast<Identifier *>(expression));
+        case ExpressionKind::BINARY_CALCUL:
+            return visitor->visitBinaryCalcul(static_cast<BinaryCalcul *>(expression));
+        case ExpressionKind::ASSIGNATION:
+            return visitor->visitAssignation(static_cast<Assignation *>(expression));
+        case ExpressionKind::POINTER:
+            return visitor->visitPointer(static_cast<Pointer *>(expression));
+        case ExpressionKind::POINTER_DEREFERENCING:
+            return visitor->visitPointerDereferencing(static_cast<PointerDereferencing *>(expression));
+        case ExpressionKind::VARIABLE_ADDRESS:
+            return visitor->visitVariableAddress(static_cast<VariableAddress *>(expression));
+        case ExpressionKind::ARRAY:
+            return visitor->visitArray(static_cast<Array *>(expression));
+        case ExpressionKind::ARRAY_ACCESS:
+            return visitor->visitArrayAccess(static_cast<ArrayAccess *>(expression));
+    }
+    throw std::logic_error("Unknown expression kind");
+}
+} // namespace filc
+
+#endif // FILC_DISPATCH_H
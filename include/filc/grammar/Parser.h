@@ -25,12 +25,30 @@
 #define FILC_PARSER_H
 
 #include "filc/grammar/ast.h"
+#include "filc/utils/Diagnostics.h"
+#include "filc/utils/SourceManager.h"
+#include "filc/utils/TimeReport.h"
 #include <memory>
 
 namespace filc {
 class ParserProxy {
   public:
-    static auto parse(const std::string &filename) -> std::shared_ptr<Program>;
+    /**
+     * Positions of the returned program refer to the source loaded in sources, it should outlive the program.
+     * Lexing and parsing are timed in time_report when one is given.
+     * Syntax errors are reported to diagnostics when one is given, and written to stderr otherwise.
+     */
+    static auto parse(
+        const std::string &filename,
+        SourceManager &sources,
+        TimeReport *time_report  = nullptr,
+        Diagnostics *diagnostics = nullptr
+    ) -> std::shared_ptr<Program>;
+
+    /**
+     * Number of files parsed again with full context prediction, because SLL prediction failed on them
+     */
+    [[nodiscard]] static auto getFullContextParseCount() -> size_t;
 };
 }
 
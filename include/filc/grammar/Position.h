@@ -25,6 +25,7 @@
 #define FILC_POSITION_H
 
 #include "antlr4-runtime.h"
+#include "filc/utils/SourceBuffer.h"
 #include <utility>
 #include <vector>
 
@@ -35,6 +36,17 @@ class Position {
 
     Position(const antlr4::Token* start_token, const antlr4::Token* end_token);
 
+    /**
+     * Single character of source, for errors found where there is no token yet, like lexer errors
+     */
+    Position(const SourceBuffer *source, unsigned int line, unsigned int column);
+
+    Position(
+        const SourceBuffer *source,
+        std::pair<unsigned int, unsigned int> start_position,
+        std::pair<unsigned int, unsigned int> end_position
+    );
+
     [[nodiscard]] auto getFilename() const -> std::string;
 
     [[nodiscard]] auto getStartPosition() const -> std::pair<unsigned int, unsigned int>;
@@ -49,6 +61,7 @@ class Position {
     std::string _filename;
     std::pair<unsigned int, unsigned int> _start_position;
     std::pair<unsigned int, unsigned int> _end_position;
+    const SourceBuffer *_source;
 };
 }
 
@@ -0,0 +1,70 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2025-Present Kevin Traini
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef FILC_SOURCESTREAM_H
+#define FILC_SOURCESTREAM_H
+
+#include "antlr4-runtime.h"
+#include "filc/utils/SourceBuffer.h"
+#include <string>
+
+namespace filc {
+/**
+ * Lexer input reading directly the bytes of a SourceBuffer, without decoding it into another buffer.
+ * Indexes and columns are counted in bytes. Text of tokens is a byte range, so UTF-8 content is kept as is.
+ */
+class SourceStream final: public antlr4::CharStream {
+  public:
+    explicit SourceStream(const SourceBuffer *source);
+
+    [[nodiscard]] auto getSource() const -> const SourceBuffer *;
+
+    auto consume() -> void override;
+
+    auto LA(ssize_t i) -> size_t override;
+
+    auto mark() -> ssize_t override;
+
+    auto release(ssize_t marker) -> void override;
+
+    auto index() -> size_t override;
+
+    auto seek(size_t index) -> void override;
+
+    auto size() -> size_t override;
+
+    [[nodiscard]] auto getSourceName() const -> std::string override;
+
+    auto getText(const antlr4::misc::Interval &interval) -> std::string override;
+
+    [[nodiscard]] auto toString() const -> std::string override;
+
+  private:
+    const SourceBuffer *_source;
+    const unsigned char *_data;
+    size_t _size;
+    size_t _position;
+};
+}
+
+#endif // FILC_SOURCESTREAM_H
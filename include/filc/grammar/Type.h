@@ -24,15 +24,52 @@
 #ifndef FILC_TYPE_H
 #define FILC_TYPE_H
 
+#include <cstddef>
 #include <llvm/IR/Type.h>
 #include <memory>
 #include <string>
 
 namespace filc {
+class AbstractType;
+
+enum class TypeClass : unsigned char {
+    SIGNED_INT,
+    UNSIGNED_INT,
+    FLOAT,
+    BOOL,
+    POINTER,
+    OTHER,
+};
+
+constexpr std::size_t TYPE_CLASS_COUNT = static_cast<std::size_t>(TypeClass::OTHER) + 1;
+
+struct TypeTraits {
+    bool is_signed_int         = false;
+    bool is_unsigned_int       = false;
+    bool is_float              = false;
+    bool is_bool               = false;
+    bool is_pointer            = false;
+    bool is_array              = false;
+    unsigned int bit_width     = 0;
+    AbstractType *element_type = nullptr;
+    TypeClass type_class       = TypeClass::OTHER;
+
+    [[nodiscard]] auto isInteger() const noexcept -> bool;
+
+    [[nodiscard]] auto isNumeric() const noexcept -> bool;
+};
+
 class AbstractType {
   public:
     virtual ~AbstractType() = default;
 
+    /**
+     * Identifier given by the Environment, shared by a type and all its aliases. 0 means not interned.
+     */
+    [[nodiscard]] auto getId() const noexcept -> unsigned int;
+
+    [[nodiscard]] auto getTraits() const noexcept -> const TypeTraits &;
+
     [[nodiscard]] virtual auto getName() const noexcept -> std::string = 0;
 
     [[nodiscard]] virtual auto getDisplayName() const noexcept -> std::string = 0;
@@ -50,6 +87,10 @@ class AbstractType {
 
   private:
     llvm::Type *_llvm_type = nullptr;
+    unsigned int _id       = 0;
+    TypeTraits _traits;
+
+    friend class Environment;
 };
 
 class Type final : public AbstractType {
@@ -117,6 +158,8 @@ class AliasType final : public AbstractType {
 
     [[nodiscard]] auto toDisplay() const noexcept -> std::string override;
 
+    [[nodiscard]] auto getAliasedType() const noexcept -> std::shared_ptr<AbstractType>;
+
     auto generateLLVMType(llvm::LLVMContext *context) -> void override;
 
   private:
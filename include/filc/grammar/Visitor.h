@@ -26,11 +26,9 @@
 
 #include "filc/grammar/ast.h"
 
-#include <any>
+#include <cstddef>
 #include <llvm/IR/Value.h>
-#include <map>
-#include <stack>
-#include <stdexcept>
+#include <vector>
 
 namespace filc {
 template<typename Return> class Visitor {
@@ -80,33 +78,52 @@ class Visitable {
     virtual auto acceptIRVisitor(Visitor<llvm::Value *> *visitor) -> llvm::Value * = 0;
 };
 
-class VisitorContext final {
+/**
+ * Stack of typed frames, the values of a frame are not visible from the frames stacked on top of it.
+ * Frames are kept allocated once popped, so stack and unstack do not allocate in steady state.
+ */
+template<typename Frame> class VisitorContext final {
   public:
-    VisitorContext();
-
-    auto stack() -> void;
+    VisitorContext() {
+        stack();
+    }
 
-    auto unstack() -> void;
+    auto stack() -> Frame & {
+        if (_depth == _frames.size()) {
+            _frames.emplace_back();
+        } else {
+            _frames[_depth] = Frame();
+        }
+        _depth++;
 
-    auto set(const std::string &key, const std::any &value) -> void;
+        return top();
+    }
 
-    auto unset(const std::string &key) -> void;
+    auto unstack() -> void {
+        if (_depth > 1) {
+            _depth--;
+        }
+    }
 
-    [[nodiscard]] auto has(const std::string &key) const -> bool;
+    [[nodiscard]] auto top() -> Frame & {
+        return _frames[_depth - 1];
+    }
 
-    template<typename T>
-    auto get(const std::string &key) const -> T {
-        if (_values.top().find(key) == _values.top().end()) {
-            throw std::logic_error("There is not value for key: " + key);
-        }
+    [[nodiscard]] auto top() const -> const Frame & {
+        return _frames[_depth - 1];
+    }
 
-        return std::any_cast<T>(_values.top().at(key));
+    [[nodiscard]] auto depth() const -> std::size_t {
+        return _depth;
     }
 
-    auto clear() -> void;
+    auto clear() -> void {
+        top() = Frame();
+    }
 
   private:
-    std::stack<std::map<std::string, std::any>> _values;
+    std::vector<Frame> _frames;
+    std::size_t _depth = 0;
 };
 } // namespace filc
 
@@ -32,9 +32,9 @@
 namespace filc {
 class Array final : public Expression {
   public:
-    explicit Array(const std::vector<std::shared_ptr<Expression>> &values);
+    explicit Array(std::vector<Expression *> values);
 
-    [[nodiscard]] auto getValues() const -> const std::vector<std::shared_ptr<Expression>> &;
+    [[nodiscard]] auto getValues() const -> const std::vector<Expression *> &;
 
     [[nodiscard]] auto getSize() const -> unsigned long;
 
@@ -49,14 +49,14 @@ class Array final : public Expression {
   private:
     unsigned long _size;
     unsigned long _full_size;
-    std::vector<std::shared_ptr<Expression>> _values;
+    std::vector<Expression *> _values;
 };
 
 class ArrayAccess final : public Expression {
   public:
-    ArrayAccess(std::shared_ptr<Expression> array, unsigned int index);
+    ArrayAccess(Expression *array, unsigned int index);
 
-    [[nodiscard]] auto getArray() const -> std::shared_ptr<Expression>;
+    [[nodiscard]] auto getArray() const -> Expression *;
 
     [[nodiscard]] auto getIndex() const -> unsigned int;
 
@@ -65,7 +65,7 @@ class ArrayAccess final : public Expression {
     auto acceptIRVisitor(Visitor<llvm::Value *> *visitor) -> llvm::Value * override;
 
   private:
-    std::shared_ptr<Expression> _array;
+    Expression *_array;
     unsigned int _index;
 };
 } // namespace filc
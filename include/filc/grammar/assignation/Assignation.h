@@ -31,11 +31,11 @@
 namespace filc {
 class Assignation final: public Expression {
   public:
-    Assignation(std::string identifier, std::shared_ptr<Expression> value);
+    Assignation(std::string identifier, Expression *value);
 
     [[nodiscard]] auto getIdentifier() const -> std::string;
 
-    [[nodiscard]] auto getValue() const -> std::shared_ptr<Expression>;
+    [[nodiscard]] auto getValue() const -> Expression *;
 
     auto acceptVoidVisitor(Visitor<void> *visitor) -> void override;
 
@@ -43,7 +43,7 @@ class Assignation final: public Expression {
 
   private:
     std::string _identifier;
-    std::shared_ptr<Expression> _value;
+    Expression *_value;
 };
 }
 
@@ -0,0 +1,68 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2025-Present Kevin Traini
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef FILC_BINARYCALCULBUILDER_H
+#define FILC_BINARYCALCULBUILDER_H
+
+#include "filc/grammar/calcul/BinaryOperator.h"
+#include "filc/grammar/expression/Expression.h"
+#include "filc/utils/Arena.h"
+#include <vector>
+
+namespace filc {
+/**
+ * Operator precedence parsing of a flat sequence `operand (operator operand)*` into BinaryCalcul nodes.
+ * Operands and operators are kept on explicit stacks, so the length of the sequence is not limited by recursion.
+ */
+class BinaryCalculBuilder final {
+  public:
+    explicit BinaryCalculBuilder(Arena *arena);
+
+    /**
+     * start and end tokens of each operand give the position of the calculs it is part of
+     */
+    auto pushOperand(Expression *operand, const antlr4::Token *start_token, const antlr4::Token *end_token) -> void;
+
+    auto pushOperator(BinaryOperator op) -> void;
+
+    /**
+     * Expression of the whole sequence, operands and operators must alternate, starting and ending with an operand
+     */
+    [[nodiscard]] auto build() -> Expression *;
+
+  private:
+    struct Operand {
+        Expression *expression;
+        const antlr4::Token *start_token;
+        const antlr4::Token *end_token;
+    };
+
+    Arena *_arena;
+    std::vector<Operand> _operands;
+    std::vector<BinaryOperator> _operators;
+
+    auto reduce() -> void;
+};
+} // namespace filc
+
+#endif // FILC_BINARYCALCULBUILDER_H
@@ -21,36 +21,37 @@
  * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
  * SOFTWARE.
  */
-#include "filc/grammar/Visitor.h"
+#ifndef FILC_BINARYOPERATOR_H
+#define FILC_BINARYOPERATOR_H
+
+#include <cstddef>
+#include <string>
+
+namespace filc {
+enum class BinaryOperator : unsigned char {
+    MOD,
+    PLUS,
+    MINUS,
+    DIV,
+    STAR,
+    LT,
+    LTE,
+    GT,
+    GTE,
+    EQEQ,
+    NEQ,
+    AND,
+    OR,
+};
+
+constexpr std::size_t BINARY_OPERATOR_COUNT = static_cast<std::size_t>(BinaryOperator::OR) + 1;
+
+[[nodiscard]] auto toString(BinaryOperator op) -> std::string;
 
-using namespace filc;
-
-VisitorContext::VisitorContext() {
-    stack();
-}
-
-auto VisitorContext::stack() -> void {
-    _values.emplace();
-}
-
-auto VisitorContext::unstack() -> void {
-    if (_values.size() > 1) {
-        _values.pop();
-    }
-}
-
-auto VisitorContext::set(const std::string &key, const std::any &value) -> void {
-    _values.top()[key] = value;
-}
-
-auto VisitorContext::unset(const std::string &key) -> void {
-    _values.top().erase(key);
-}
-
-auto VisitorContext::has(const std::string &key) const -> bool {
-    return _values.top().find(key) != _values.top().end();
-}
+/**
+ * Binding strength of op, operators with a higher precedence are grouped first. All operators are left associative.
+ */
+[[nodiscard]] auto getPrecedence(BinaryOperator op) -> unsigned int;
+} // namespace filc
 
-auto VisitorContext::clear() -> void {
-    _values.top().clear();
-}
+#endif // FILC_BINARYOPERATOR_H
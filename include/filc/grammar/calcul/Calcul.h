@@ -24,29 +24,36 @@
 #ifndef FILC_CALCUL_H
 #define FILC_CALCUL_H
 
+#include "filc/grammar/calcul/BinaryOperator.h"
 #include "filc/grammar/expression/Expression.h"
 #include <memory>
-#include <string>
+#include <vector>
 
 namespace filc {
 class BinaryCalcul final: public Expression {
   public:
-    BinaryCalcul(std::shared_ptr<Expression> left_expression, std::string op, std::shared_ptr<Expression> right_expression);
+    BinaryCalcul(Expression *left_expression, BinaryOperator op, Expression *right_expression);
 
-    [[nodiscard]] auto getLeftExpression() const -> std::shared_ptr<Expression>;
+    [[nodiscard]] auto getLeftExpression() const -> Expression *;
 
-    [[nodiscard]] auto getOperator() const -> std::string;
+    [[nodiscard]] auto getOperator() const -> BinaryOperator;
 
-    [[nodiscard]] auto getRightExpression() const -> std::shared_ptr<Expression>;
+    [[nodiscard]] auto getRightExpression() const -> Expression *;
+
+    /**
+     * Calculs nested through left operands, from the left operand of this one to the innermost.
+     * Chains such as a + b + c are as deep as they are long, visitors use it to walk them without recursion.
+     */
+    [[nodiscard]] auto getLeftChain() const -> std::vector<BinaryCalcul *>;
 
     auto acceptVoidVisitor(Visitor<void> *visitor) -> void override;
 
     auto acceptIRVisitor(Visitor<llvm::Value *> *visitor) -> llvm::Value * override;
 
   private:
-    std::shared_ptr<Expression> _left_expression;
-    std::string _operator;
-    std::shared_ptr<Expression> _right_expression;
+    Expression *_left_expression;
+    BinaryOperator _operator;
+    Expression *_right_expression;
 };
 }
 
@@ -29,10 +29,29 @@
 #include "filc/grammar/Type.h"
 
 namespace filc {
+enum class ExpressionKind : unsigned char {
+    BOOLEAN_LITERAL,
+    INTEGER_LITERAL,
+    FLOAT_LITERAL,
+    CHARACTER_LITERAL,
+    STRING_LITERAL,
+    VARIABLE_DECLARATION,
+    IDENTIFIER,
+    BINARY_CALCUL,
+    ASSIGNATION,
+    POINTER,
+    POINTER_DEREFERENCING,
+    VARIABLE_ADDRESS,
+    ARRAY,
+    ARRAY_ACCESS,
+};
+
 class Expression: public Visitable {
   public:
     virtual ~Expression() = default;
 
+    [[nodiscard]] auto getKind() const -> ExpressionKind;
+
     auto setPosition(const Position& position) -> void;
 
     [[nodiscard]] auto getPosition() const -> const Position&;
@@ -42,9 +61,10 @@ class Expression: public Visitable {
     [[nodiscard]] auto getType() const -> const std::shared_ptr<AbstractType>&;
 
   protected:
-    Expression();
+    explicit Expression(ExpressionKind kind);
 
   private:
+    ExpressionKind _kind;
     Position _position;
     std::shared_ptr<AbstractType> _type;
 };
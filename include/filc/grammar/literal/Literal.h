@@ -38,7 +38,7 @@ class Literal: public Expression {
     T _value;
 
   protected:
-    explicit Literal(T value): _value(value) {};
+    Literal(ExpressionKind kind, T value): Expression(kind), _value(value) {};
 };
 
 class BooleanLiteral final: public Literal<bool> {
@@ -32,11 +32,11 @@
 namespace filc {
 class Pointer final : public Expression {
   public:
-    Pointer(std::string type_name, const std::shared_ptr<Expression> &value);
+    Pointer(std::string type_name, Expression *value);
 
     [[nodiscard]] auto getTypeName() const -> std::string;
 
-    [[nodiscard]] auto getValue() const -> std::shared_ptr<Expression>;
+    [[nodiscard]] auto getValue() const -> Expression *;
 
     [[nodiscard]] auto getPointedType() const -> std::shared_ptr<AbstractType>;
 
@@ -46,35 +46,35 @@ class Pointer final : public Expression {
 
   private:
     std::string _type_name;
-    std::shared_ptr<Expression> _value;
+    Expression *_value;
 };
 
 class PointerDereferencing final : public Expression {
   public:
-    explicit PointerDereferencing(const std::shared_ptr<Expression> &pointer);
+    explicit PointerDereferencing(Expression *pointer);
 
-    [[nodiscard]] auto getPointer() const -> std::shared_ptr<Expression>;
+    [[nodiscard]] auto getPointer() const -> Expression *;
 
     auto acceptVoidVisitor(Visitor<void> *visitor) -> void override;
 
     auto acceptIRVisitor(Visitor<llvm::Value *> *visitor) -> llvm::Value * override;
 
   private:
-    std::shared_ptr<Expression> _pointer;
+    Expression *_pointer;
 };
 
 class VariableAddress final : public Expression {
   public:
-    explicit VariableAddress(const std::shared_ptr<Expression> &variable);
+    explicit VariableAddress(Expression *variable);
 
-    [[nodiscard]] auto getVariable() const -> std::shared_ptr<Expression>;
+    [[nodiscard]] auto getVariable() const -> Expression *;
 
     auto acceptVoidVisitor(Visitor<void> *visitor) -> void override;
 
     auto acceptIRVisitor(Visitor<llvm::Value *> *visitor) -> llvm::Value * override;
 
   private:
-    std::shared_ptr<Expression> _variable;
+    Expression *_variable;
 };
 } // namespace filc
 
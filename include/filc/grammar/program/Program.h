@@ -26,22 +26,33 @@
 
 #include "filc/grammar/ast.h"
 #include "filc/grammar/Visitor.h"
+#include "filc/utils/Arena.h"
+#include "filc/utils/SourceBuffer.h"
 #include <vector>
-#include <memory>
 
 namespace filc {
 class Program final: public Visitable {
   public:
-    explicit Program(const std::vector<std::shared_ptr<Expression>> &expressions);
+    Program();
 
-    [[nodiscard]] auto getExpressions() const -> const std::vector<std::shared_ptr<Expression>> &;
+    [[nodiscard]] auto getArena() -> Arena &;
+
+    auto setSource(const SourceBuffer *source) -> void;
+
+    [[nodiscard]] auto getSource() const -> const SourceBuffer *;
+
+    auto addExpression(Expression *expression) -> void;
+
+    [[nodiscard]] auto getExpressions() const -> const std::vector<Expression *> &;
 
     auto acceptVoidVisitor(Visitor<void> *visitor) -> void override;
 
     auto acceptIRVisitor(Visitor<llvm::Value *> *visitor) -> llvm::Value * override;
 
   private:
-    std::vector<std::shared_ptr<Expression>> _expressions;
+    const SourceBuffer *_source;
+    Arena _arena;
+    std::vector<Expression *> _expressions;
 };
 }
 
@@ -31,7 +31,7 @@
 namespace filc {
 class VariableDeclaration final: public Expression {
   public:
-    VariableDeclaration(bool is_constant, std::string name, std::string _type_name, std::shared_ptr<Expression> value);
+    VariableDeclaration(bool is_constant, std::string name, std::string _type_name, Expression *value);
 
     [[nodiscard]] auto isConstant() const -> bool;
 
@@ -39,7 +39,7 @@ class VariableDeclaration final: public Expression {
 
     [[nodiscard]] auto getTypeName() const -> std::string;
 
-    [[nodiscard]] auto getValue() const -> std::shared_ptr<Expression>;
+    [[nodiscard]] auto getValue() const -> Expression *;
 
     auto acceptVoidVisitor(Visitor<void> *visitor) -> void override;
 
@@ -49,7 +49,7 @@ class VariableDeclaration final: public Expression {
     bool _constant;
     std::string _name;
     std::string _type_name;
-    std::shared_ptr<Expression> _value;
+    Expression *_value;
 };
 }
 
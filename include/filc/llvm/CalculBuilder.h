@@ -38,15 +38,12 @@ class CalculBuilder final {
     IRGenerator *_generator;
     llvm::IRBuilder<> *_builder;
 
-    auto buildSignedInteger(const BinaryCalcul *calcul) const -> llvm::Value *;
+    /**
+     * Value of calcul, its left operand being already built
+     */
+    auto buildOperation(const BinaryCalcul *calcul, llvm::Value *left) const -> llvm::Value *;
 
-    auto buildUnsignedInteger(const BinaryCalcul *calcul) const -> llvm::Value *;
-
-    auto buildFloat(const BinaryCalcul *calcul) const -> llvm::Value *;
-
-    auto buildBool(const BinaryCalcul *calcul) const -> llvm::Value *;
-
-    auto buildPointer(const BinaryCalcul *calcul) const -> llvm::Value *;
+    auto buildPointerAdd(const BinaryCalcul *calcul, llvm::Value *left) const -> llvm::Value *;
 
     auto static buildError(const BinaryCalcul *calcul) -> std::logic_error;
 };
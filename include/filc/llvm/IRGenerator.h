@@ -29,20 +29,88 @@
 #include "filc/llvm/GeneratorContext.h"
 #include <llvm/IR/Module.h>
 #include <llvm/IR/IRBuilder.h>
+#include <llvm/Passes/OptimizationLevel.h>
+#include <llvm/Target/TargetMachine.h>
+#include <iostream>
 #include <memory>
+#include <string>
+#include <unordered_map>
 
 namespace filc {
+struct IRGeneratorFrame {
+    llvm::Value *array_def = nullptr;
+    bool was_in_array_def  = false;
+    bool in_array_access   = false;
+};
+
+struct StringPoolStats {
+    std::size_t literals    = 0;
+    std::size_t globals     = 0;
+    std::size_t saved_bytes = 0;
+};
+
+struct TargetDescription {
+    std::string triple;
+    std::string cpu;
+    std::string features;
+};
+
 class IRGenerator final: public Visitor<llvm::Value *> {
   friend class CalculBuilder;
 
   public:
-    explicit IRGenerator(const std::string &filename, const Environment *environment);
+    /**
+     * Target, emission and JIT errors are written to err
+     */
+    explicit IRGenerator(const std::string &filename, const Environment *environment, std::ostream &err = std::cerr);
 
     ~IRGenerator() override = default;
 
     [[nodiscard]] auto dump() const -> std::string;
 
-    [[nodiscard]] auto toTarget(const std::string &output_file, const std::string &target_triple) const -> int;
+    /**
+     * String literals generated, globals emitted for them and bytes saved by sharing identical strings and suffixes
+     */
+    [[nodiscard]] auto getStringPoolStats() const -> const StringPoolStats &;
+
+    /**
+     * Register the LLVM backend handling target_triple, and only this one. Returns nullptr and fills error if no
+     * backend built into filc handles it.
+     */
+    static auto initializeTarget(const std::string &target_triple, std::string &error) -> const llvm::Target *;
+
+    /**
+     * Resolve default triple and native CPU to what the target machine will actually be created for.
+     * Native CPU only describes the host, so it fills error when target_triple is for another machine.
+     */
+    [[nodiscard]] static auto resolveTarget(
+        const std::string &target_triple, const std::string &cpu, const std::string &features, std::string &error
+    ) -> TargetDescription;
+
+    [[nodiscard]] auto setupTarget(
+        const std::string &target_triple,
+        const std::string &cpu,
+        const std::string &features,
+        const std::string &optimization_level
+    ) -> int;
+
+    /**
+     * Run the default optimization pipeline of the level given to setupTarget.
+     * When llvm::TimePassesIsEnabled is set, pass timings are written to pass_timings.
+     */
+    auto optimize(llvm::raw_ostream *pass_timings = nullptr) -> void;
+
+    /**
+     * Write the module to output_file. emit is one of: exe, obj, asm, bc, ll.
+     * exe links the object with the system C compiler driver (cc), or with <triple>-cc when targeting another machine.
+     */
+    [[nodiscard]] auto toTarget(const std::string &output_file, const std::string &emit) const -> int;
+
+    /**
+     * Run main() in-process with ORC LLJIT and return its result.
+     * The module is handed over to the JIT, so the generator can't be used afterward.
+     */
+    [[nodiscard]] auto run() -> int;
 
     auto visitProgram(Program *program) -> llvm::Value * override;
 
@@ -75,11 +143,55 @@ class IRGenerator final: public Visitor<llvm::Value *> {
     auto visitArrayAccess(ArrayAccess *array_access) -> llvm::Value * override;
 
   private:
-    std::unique_ptr<VisitorContext> _visitor_context;
+    const Environment *_environment;
+    std::ostream &_err;
+    VisitorContext<IRGeneratorFrame> _visitor_context;
     std::unique_ptr<llvm::LLVMContext> _llvm_context;
     std::unique_ptr<llvm::Module> _module;
     std::unique_ptr<llvm::IRBuilder<>> _builder;
     GeneratorContext _context;
+    std::unique_ptr<llvm::TargetMachine> _target_machine;
+    llvm::OptimizationLevel _optimization_level;
+    std::unordered_map<std::string, llvm::GlobalVariable *> _string_pool;
+    std::unordered_map<const Array *, bool> _constant_arrays;
+    StringPoolStats _string_pool_stats;
+
+    auto emitFile(llvm::raw_pwrite_stream &out, llvm::CodeGenFileType file_type) const -> int;
+
+    /**
+     * C compiler driver linking for the target: cc for the host, <triple>-cc or <triple>-gcc for another machine.
+     * Returns an empty string and writes an error if there is none.
+     */
+    auto findLinker() const -> std::string;
+
+    auto link(const std::string &linker, const std::string &object_file, const std::string &output_file) const -> int;
+
+    /**
+     * Constant folded by validation for expression, nullptr if it has to be built
+     */
+    auto getFoldedConstant(const Expression *expression) const -> llvm::Constant *;
+
+    /**
+     * Private read-only global holding array when all its values are constants, nullptr otherwise
+     */
+    auto buildConstantArray(Array *array) -> llvm::GlobalVariable *;
+
+    /**
+     * Whether all values of array are constants, the walk stops at the first one which is not. The answer is kept for
+     * each array, so the sub arrays of an array built element by element are not walked again.
+     */
+    auto isConstantArray(const Array *array) -> bool;
+
+    auto isConstantValue(const Expression *expression) -> bool;
+
+    auto buildConstantValue(Expression *expression) -> llvm::Constant *;
+
+    auto copyConstantArray(llvm::GlobalVariable *constant_array) -> llvm::Value *;
+
+    /**
+     * Point each pooled string ending another one into it, then drop its global
+     */
+    auto mergeStringSuffixes() -> void;
 };
 }
 
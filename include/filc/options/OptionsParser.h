@@ -27,6 +27,7 @@
 #include <cxxopts.hpp>
 #include <exception>
 #include <string>
+#include <vector>
 
 namespace filc {
 class OptionsParser final {
@@ -43,18 +44,67 @@ class OptionsParser final {
 
     static auto showVersion(std::ostream &out) -> void;
 
+    [[nodiscard]] auto isRun() const -> bool;
+
+    [[nodiscard]] auto isTimeReport() const -> bool;
+
+    [[nodiscard]] auto isTimeTrace() const -> bool;
+
+    [[nodiscard]] auto getCacheDirectory() const -> std::string;
+
+    [[nodiscard]] auto getCacheSize() const -> unsigned long;
+
+    [[nodiscard]] auto isCacheStats() const -> bool;
+
+    [[nodiscard]] auto getServerSocket() const -> std::string;
+
+    /**
+     * Socket of --connect, given as --connect=<socket> or as --connect <socket> when the next argument is a socket
+     */
+    [[nodiscard]] auto getConnectSocket() const -> std::string;
+
     [[nodiscard]] auto getFile() const -> std::string;
 
+    [[nodiscard]] auto getFiles() const -> std::vector<std::string>;
+
+    [[nodiscard]] auto getJobs() const -> unsigned int;
+
     [[nodiscard]] auto getDump() const -> std::string;
 
     [[nodiscard]] auto getOutputFile() const -> std::string;
 
+    /**
+     * Whether -o was given, rather than getOutputFile() falling back to a.out
+     */
+    [[nodiscard]] auto isOutputFileSet() const -> bool;
+
     [[nodiscard]] auto getTarget() const -> std::string;
 
+    [[nodiscard]] auto getEmit() const -> std::string;
+
+    [[nodiscard]] auto getDiagnosticsFormat() const -> std::string;
+
+    [[nodiscard]] auto isWarningsDisabled() const -> bool;
+
+    [[nodiscard]] auto isWarningsAsErrors() const -> bool;
+
+    [[nodiscard]] auto getDisabledWarnings() const -> std::vector<std::string>;
+
+    [[nodiscard]] auto getMaxDiagnostics() const -> unsigned int;
+
+    [[nodiscard]] auto getCpu() const -> std::string;
+
+    [[nodiscard]] auto getCpuFeatures() const -> std::string;
+
+    [[nodiscard]] auto getOptimizationLevel() const -> std::string;
+
   private:
     cxxopts::Options _options;
     bool _parsed;
     cxxopts::ParseResult _result;
+    std::string _separate_connect_socket;
+
+    [[nodiscard]] auto getWarningOptions() const -> std::vector<std::string>;
 };
 
 class OptionsParserException final : public std::exception {
@@ -0,0 +1,83 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2025-Present Kevin Traini
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef FILC_COMPILERSERVER_H
+#define FILC_COMPILERSERVER_H
+
+#include <atomic>
+#include <ostream>
+#include <string>
+#include <vector>
+
+namespace filc {
+/**
+ * Long-lived compiler process listening on a Unix socket.
+ * Requests are handled one at a time, each one by a fresh FilCompiler, so that the LLVM targets and the parser
+ * caches initialized by the first compilations are reused by all the following ones.
+ * Only processes of the user running the server are served.
+ */
+class CompilerServer final {
+  public:
+    explicit CompilerServer(std::string socket_path);
+
+    /**
+     * $XDG_RUNTIME_DIR/filc.sock, or filc.sock in a directory of the temporary directory private to the user
+     */
+    [[nodiscard]] static auto getDefaultSocketPath() -> std::string;
+
+    CompilerServer(const CompilerServer &other) = delete;
+
+    auto operator=(const CompilerServer &other) -> CompilerServer & = delete;
+
+    ~CompilerServer();
+
+    [[nodiscard]] auto open() -> int;
+
+    [[nodiscard]] auto serve() -> int;
+
+    auto stop() -> void;
+
+  private:
+    std::string _socket_path;
+    int _socket;
+    std::atomic<bool> _stopped;
+
+    auto handle(int client) const -> void;
+};
+
+/**
+ * Forward a command line to a CompilerServer run by the same user, and write back its output.
+ */
+class CompilerClient final {
+  public:
+    explicit CompilerClient(std::string socket_path);
+
+    [[nodiscard]] auto send(const std::vector<std::string> &arguments, std::ostream &out, std::ostream &err) const
+        -> int;
+
+  private:
+    std::string _socket_path;
+};
+}
+
+#endif // FILC_COMPILERSERVER_H
@@ -0,0 +1,83 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2025-Present Kevin Traini
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef FILC_ARENA_H
+#define FILC_ARENA_H
+
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace filc {
+/**
+ * Bump allocator owning every object allocated in it.
+ * When the arena is destroyed, objects that are not trivially destructible are destroyed one by one, in reverse order
+ * of allocation, then its chunks are released. AST nodes hold strings and types, so each of them costs a destructor
+ * call.
+ */
+class Arena final {
+  public:
+    Arena();
+
+    Arena(const Arena &other) = delete;
+
+    auto operator=(const Arena &other) -> Arena & = delete;
+
+    ~Arena();
+
+    template<typename T, typename... Args> auto make(Args &&...args) -> T * {
+        auto object = new (allocate(sizeof(T), alignof(T))) T(std::forward<Args>(args)...);
+        if constexpr (! std::is_trivially_destructible_v<T>) {
+            _destructors.emplace_back(object, [](void *pointer) {
+                static_cast<T *>(pointer)->~T();
+            });
+        }
+
+        return object;
+    }
+
+    [[nodiscard]] auto getAllocatedSize() const -> size_t;
+
+    [[nodiscard]] auto getObjectCount() const -> size_t;
+
+    /**
+     * Objects whose destructor runs when the arena is destroyed
+     */
+    [[nodiscard]] auto getDestructorCount() const -> size_t;
+
+  private:
+    std::vector<std::unique_ptr<char[]>> _chunks;
+    char *_current;
+    size_t _remaining;
+    size_t _allocated_size;
+    size_t _object_count;
+    std::vector<std::pair<void *, void (*)(void *)>> _destructors;
+
+    auto allocate(size_t size, size_t alignment) -> void *;
+};
+} // namespace filc
+
+#endif // FILC_ARENA_H
@@ -0,0 +1,132 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2025-Present Kevin Traini
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef FILC_DIAGNOSTICS_H
+#define FILC_DIAGNOSTICS_H
+
+#include "filc/grammar/Position.h"
+#include "filc/utils/SourceBuffer.h"
+#include <ostream>
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+namespace filc {
+enum class Severity : unsigned char { WARNING, ERROR };
+
+enum class DiagnosticsFormat : unsigned char { TEXT, JSON, SARIF };
+
+struct Diagnostic {
+    Severity severity;
+    std::string code;
+    std::string message;
+    Position position;
+};
+
+/**
+ * Collects the diagnostics of a compilation. They are only rendered by flush, at the end of a phase, with a single
+ * write to the output stream. SARIF results are kept instead, and written by writeSarifLog.
+ */
+class Diagnostics final {
+  public:
+    explicit Diagnostics(std::ostream &out, DiagnosticsFormat format = DiagnosticsFormat::TEXT);
+
+    /**
+     * Format named text, json or sarif
+     */
+    [[nodiscard]] static auto getFormat(const std::string &name) -> DiagnosticsFormat;
+
+    /**
+     * Turn off every warning (-w)
+     */
+    auto disableWarnings() -> void;
+
+    /**
+     * Turn off warnings of the given code (-Wno-<code>)
+     */
+    auto disableWarning(const std::string &code) -> void;
+
+    /**
+     * Report warnings as errors (-Werror)
+     */
+    auto setWarningsAsErrors(bool warnings_as_errors) -> void;
+
+    /**
+     * Keep at most max_diagnostics diagnostics, 0 means no limit.
+     * The count of dropped ones is rendered after them, as a note of code max-diagnostics in json and sarif.
+     */
+    auto setMaxDiagnostics(unsigned int max_diagnostics) -> void;
+
+    /**
+     * Callers should check it before building the message of a warning
+     */
+    [[nodiscard]] auto isWarningEnabled(const std::string &code) const -> bool;
+
+    auto report(Severity severity, std::string code, std::string message, const Position &position) -> void;
+
+    [[nodiscard]] auto getPending() const -> const std::vector<Diagnostic> &;
+
+    /**
+     * Whether an error has been reported, even if it is already flushed
+     */
+    [[nodiscard]] auto hasError() const -> bool;
+
+    auto flush() -> void;
+
+    /**
+     * Keep every reported diagnostic as it is before -Werror and the limit apply, so that a cached compilation
+     * can replay them
+     */
+    auto recordReported() -> void;
+
+    [[nodiscard]] auto serializeReported() const -> std::string;
+
+    /**
+     * Report again diagnostics from serializeReported, their positions are in source.
+     * Returns false if serialized is malformed.
+     */
+    auto replay(const std::string &serialized, const SourceBuffer *source) -> bool;
+
+    /**
+     * Write one SARIF log holding the flushed results of all diagnostics, if there are any
+     */
+    static auto writeSarifLog(std::ostream &out, const std::vector<const Diagnostics *> &diagnostics) -> void;
+
+  private:
+    std::ostream &_out;
+    DiagnosticsFormat _format;
+    std::vector<Diagnostic> _pending;
+    bool _error;
+    bool _warnings_disabled;
+    bool _warnings_as_errors;
+    std::unordered_set<std::string> _disabled_warnings;
+    unsigned int _max_diagnostics;
+    unsigned int _kept;
+    unsigned int _dropped;
+    std::vector<std::string> _sarif_results;
+    bool _recording;
+    std::vector<Diagnostic> _reported;
+};
+}
+
+#endif // FILC_DIAGNOSTICS_H
@@ -27,9 +27,9 @@
 #include "filc/grammar/Position.h"
 #include <string>
 
-#define WARNING "WARNING"
+#define WARNING_TAG "WARNING"
 #define WARNING_COLOR "\033[33m"
-#define ERROR "ERROR"
+#define ERROR_TAG "ERROR"
 #define ERROR_COLOR "\033[31m"
 
 namespace filc {
@@ -0,0 +1,76 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2025-Present Kevin Traini
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef FILC_SOURCEBUFFER_H
+#define FILC_SOURCEBUFFER_H
+
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace filc {
+/**
+ * Read-only content of a source file, memory mapped when it comes from disk.
+ * Line start offsets are indexed once, so that any line can be retrieved without rescanning the content.
+ */
+class SourceBuffer final {
+  public:
+    [[nodiscard]] static auto open(const std::string &filename) -> std::unique_ptr<SourceBuffer>;
+
+    SourceBuffer(std::string name, std::string content);
+
+    SourceBuffer(const SourceBuffer &other) = delete;
+
+    auto operator=(const SourceBuffer &other) -> SourceBuffer & = delete;
+
+    ~SourceBuffer();
+
+    [[nodiscard]] auto getName() const -> const std::string &;
+
+    [[nodiscard]] auto getContent() const -> std::string_view;
+
+    [[nodiscard]] auto getLineCount() const -> size_t;
+
+    /**
+     * Line number starts at 1, the line is returned without its end of line character.
+     * An empty view is returned for lines out of the buffer.
+     */
+    [[nodiscard]] auto getLine(size_t line) const -> std::string_view;
+
+  private:
+    std::string _name;
+    std::string _owned_content;
+    const char *_data;
+    size_t _size;
+    bool _mapped;
+    std::vector<size_t> _line_offsets;
+
+    SourceBuffer(std::string name, const char *data, size_t size);
+
+    auto indexLines() -> void;
+};
+}
+
+#endif // FILC_SOURCEBUFFER_H
@@ -0,0 +1,67 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2025-Present Kevin Traini
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef FILC_SOURCEMANAGER_H
+#define FILC_SOURCEMANAGER_H
+
+#include "filc/utils/SourceBuffer.h"
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+namespace filc {
+/**
+ * Owns the sources of a compilation. Each file is read (and its lines indexed) only once, every parser and
+ * diagnostic of the compilation then share the same buffer.
+ */
+class SourceManager final {
+  public:
+    SourceManager();
+
+    SourceManager(const SourceManager &other) = delete;
+
+    auto operator=(const SourceManager &other) -> SourceManager & = delete;
+
+    /**
+     * Load filename, or return its buffer if it is already loaded
+     */
+    [[nodiscard]] auto load(const std::string &filename) -> const SourceBuffer *;
+
+    /**
+     * Register an in-memory source, its name should not be used by another source
+     */
+    auto add(const std::string &name, std::string content) -> const SourceBuffer *;
+
+    /**
+     * Buffer of name if it is already loaded, nullptr otherwise
+     */
+    [[nodiscard]] auto find(const std::string &name) const -> const SourceBuffer *;
+
+  private:
+    mutable std::mutex _mutex;
+    std::unordered_map<std::string, std::unique_ptr<SourceBuffer>> _buffers;
+};
+}
+
+#endif // FILC_SOURCEMANAGER_H
@@ -0,0 +1,108 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2025-Present Kevin Traini
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef FILC_TIMEREPORT_H
+#define FILC_TIMEREPORT_H
+
+#include <chrono>
+#include <ostream>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace filc {
+struct TimedPhase {
+    std::string name;
+    std::chrono::microseconds start;
+    std::chrono::microseconds wall_time;
+    std::chrono::microseconds cpu_time;
+    // Growth of the process maximum RSS during the phase: memory it needed beyond what was already touched before.
+    // RSS is process wide, files compiled concurrently count in each other's growth.
+    long max_rss_growth_kib;
+};
+
+/**
+ * Time, CPU time and memory growth of each phase of a compilation (--time-report, --time-trace).
+ */
+class TimeReport final {
+  public:
+    explicit TimeReport(std::string name);
+
+    /**
+     * Time elapsed since the report was created
+     */
+    [[nodiscard]] auto now() const -> std::chrono::microseconds;
+
+    auto addPhase(TimedPhase phase) -> void;
+
+    auto setCounter(const std::string &name, size_t value) -> void;
+
+    /**
+     * Free-form text written after the phase table, e.g. LLVM pass timers
+     */
+    auto addSection(const std::string &title, std::string content) -> void;
+
+    [[nodiscard]] auto getPhases() const -> const std::vector<TimedPhase> &;
+
+    [[nodiscard]] auto getCounters() const -> const std::vector<std::pair<std::string, size_t>> &;
+
+    auto write(std::ostream &out) const -> void;
+
+    /**
+     * Chrome trace-event JSON, as written by clang -ftime-trace
+     */
+    auto writeTrace(std::ostream &out) const -> void;
+
+  private:
+    std::string _name;
+    std::chrono::steady_clock::time_point _start;
+    std::vector<TimedPhase> _phases;
+    std::vector<std::pair<std::string, size_t>> _counters;
+    std::vector<std::pair<std::string, std::string>> _sections;
+};
+
+/**
+ * Times a phase until it is stopped or destroyed. Does nothing when the report is nullptr.
+ */
+class TimeScope final {
+  public:
+    TimeScope(TimeReport *report, std::string name);
+
+    TimeScope(const TimeScope &other) = delete;
+
+    auto operator=(const TimeScope &other) -> TimeScope & = delete;
+
+    ~TimeScope();
+
+    auto stop() -> void;
+
+  private:
+    TimeReport *_report;
+    std::string _name;
+    std::chrono::microseconds _start;
+    std::chrono::microseconds _cpu_start;
+    long _max_rss_start;
+};
+}
+
+#endif // FILC_TIMEREPORT_H
@@ -28,6 +28,11 @@
 
 namespace filc {
 auto parseEscapedChar(const std::string &value) -> char;
+
+/**
+ * Quote value as a JSON string
+ */
+auto toJsonString(const std::string &value) -> std::string;
 }
 
 #endif // FILC_UTILS_H
@@ -25,10 +25,10 @@
 #define FILC_CALCULVALIDATOR_H
 
 #include "filc/grammar/Type.h"
+#include "filc/grammar/calcul/BinaryOperator.h"
 #include "filc/validation/Environment.h"
 
 #include <memory>
-#include <string>
 
 namespace filc {
 class CalculValidator {
@@ -37,24 +37,12 @@ class CalculValidator {
 
     [[nodiscard]] auto isCalculValid(
         const std::shared_ptr<AbstractType> &left_type,
-        const std::string &op,
+        BinaryOperator op,
         const std::shared_ptr<AbstractType> &right_type
     ) const -> std::shared_ptr<AbstractType>;
 
   private:
     Environment *_environment;
-
-    [[nodiscard]] auto
-    isNumericOperatorValid(const std::shared_ptr<AbstractType> &left_type, const std::string &op) const
-        -> std::shared_ptr<AbstractType>;
-
-    [[nodiscard]] auto isBoolOperatorValid(const std::string &op) const -> std::shared_ptr<AbstractType>;
-
-    [[nodiscard]] auto isPointerOperatorValid(
-        const std::string &op,
-        const std::shared_ptr<AbstractType> &left_type,
-        const std::shared_ptr<AbstractType> &right_type
-    ) const -> std::shared_ptr<AbstractType>;
 };
 } // namespace filc
 
@@ -0,0 +1,90 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2025-Present Kevin Traini
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef FILC_CONSTANTEVALUATOR_H
+#define FILC_CONSTANTEVALUATOR_H
+
+#include "filc/grammar/calcul/Calcul.h"
+#include "filc/grammar/literal/Literal.h"
+#include "filc/grammar/variable/Variable.h"
+#include "filc/validation/ConstantValue.h"
+#include "filc/validation/Environment.h"
+
+#include <optional>
+#include <string>
+#include <unordered_map>
+
+namespace filc {
+enum class EvaluationStatus : unsigned char {
+    NOT_CONSTANT,
+    FOLDED,
+    // Folded, but the exact result does not fit in the type and wrapped around
+    WRAPPED,
+    DIVISION_BY_ZERO,
+    // Signed division of the minimum value by -1, undefined at runtime
+    DIVISION_OVERFLOW,
+};
+
+class ConstantEvaluator final {
+  public:
+    explicit ConstantEvaluator(Environment *environment);
+
+    /**
+     * Fold validated expression from the values of its operands, which must be evaluated before it.
+     * Values folded are stored in the environment with the semantics of the code generated for them, except for
+     * literals which are read from the tree.
+     */
+    auto evaluate(const Expression *expression) -> EvaluationStatus;
+
+    [[nodiscard]] auto getConstant(const Expression *expression) const -> std::optional<ConstantValue>;
+
+    /**
+     * Value of a val initialized with a constant, nullopt for any other name
+     */
+    [[nodiscard]] auto getNameConstant(const std::string &name) const -> std::optional<ConstantValue>;
+
+  private:
+    Environment *_environment;
+    std::unordered_map<std::string, const Expression *> _constant_names;
+
+    auto fold(const Expression *expression, const ConstantValue &value) -> EvaluationStatus;
+
+    auto evaluateIntegerLiteral(const IntegerLiteral *literal) -> EvaluationStatus;
+
+    auto evaluateVariable(const VariableDeclaration *variable) -> EvaluationStatus;
+
+    auto evaluateCalcul(const BinaryCalcul *calcul) -> EvaluationStatus;
+
+    auto evaluateIntegerCalcul(
+        const BinaryCalcul *calcul, const llvm::APInt &left, const llvm::APInt &right, bool is_signed
+    ) -> EvaluationStatus;
+
+    auto evaluateFloatCalcul(const BinaryCalcul *calcul, const llvm::APFloat &left, const llvm::APFloat &right)
+        -> EvaluationStatus;
+
+    auto evaluateBoolCalcul(const BinaryCalcul *calcul, const llvm::APInt &left, const llvm::APInt &right)
+        -> EvaluationStatus;
+};
+}
+
+#endif // FILC_CONSTANTEVALUATOR_H
@@ -0,0 +1,68 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2025-Present Kevin Traini
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef FILC_CONSTANTVALUE_H
+#define FILC_CONSTANTVALUE_H
+
+#include "filc/grammar/expression/Expression.h"
+#include <llvm/ADT/APFloat.h>
+#include <llvm/ADT/APInt.h>
+#include <llvm/IR/Constant.h>
+#include <variant>
+
+namespace filc {
+/**
+ * Value of an expression known at compile time: an integer (a bool being 1 bit wide), a float, or the expression
+ * allocating the memory a pointer points to
+ */
+class ConstantValue {
+  public:
+    explicit ConstantValue(llvm::APInt integer);
+
+    explicit ConstantValue(llvm::APFloat real);
+
+    explicit ConstantValue(const Expression *allocation);
+
+    [[nodiscard]] auto isInteger() const -> bool;
+
+    [[nodiscard]] auto isFloat() const -> bool;
+
+    [[nodiscard]] auto isAddress() const -> bool;
+
+    [[nodiscard]] auto getInteger() const -> const llvm::APInt &;
+
+    [[nodiscard]] auto getFloat() const -> const llvm::APFloat &;
+
+    [[nodiscard]] auto getAddress() const -> const Expression *;
+
+    /**
+     * nullptr for addresses, they are only known relatively to each other
+     */
+    [[nodiscard]] auto toLLVMConstant(llvm::LLVMContext *context) const -> llvm::Constant *;
+
+  private:
+    std::variant<llvm::APInt, llvm::APFloat, const Expression *> _value;
+};
+}
+
+#endif // FILC_CONSTANTVALUE_H
@@ -25,9 +25,11 @@
 #define FILC_ENVIRONMENT_H
 
 #include "filc/grammar/Type.h"
+#include "filc/validation/ConstantValue.h"
 #include "filc/validation/Name.h"
 #include <map>
 #include <string>
+#include <unordered_map>
 
 namespace filc {
 class Environment {
@@ -42,6 +44,19 @@ class Environment {
 
     auto addType(const std::shared_ptr<AbstractType> &type) -> void;
 
+    [[nodiscard]] auto getPointerType(const std::shared_ptr<AbstractType> &pointed_type)
+        -> const std::shared_ptr<AbstractType> &;
+
+    [[nodiscard]] auto getBoolType() const -> const std::shared_ptr<AbstractType> &;
+
+    [[nodiscard]] auto getIntType() const -> const std::shared_ptr<AbstractType> &;
+
+    [[nodiscard]] auto getFloatType() const -> const std::shared_ptr<AbstractType> &;
+
+    [[nodiscard]] auto getCharType() const -> const std::shared_ptr<AbstractType> &;
+
+    [[nodiscard]] auto getStringType() const -> const std::shared_ptr<AbstractType> &;
+
     [[nodiscard]] auto hasName(const std::string &name) const -> bool;
 
     [[nodiscard]] auto getName(const std::string &name) const -> const Name&;
@@ -50,9 +65,29 @@ class Environment {
 
     auto setName(const Name &name) -> void;
 
+    /**
+     * Value folded by validation for expression, nullptr for literals and values only known at runtime
+     */
+    [[nodiscard]] auto getConstant(const Expression *expression) const -> const ConstantValue *;
+
+    auto setConstant(const Expression *expression, const ConstantValue &value) -> void;
+
   private:
     std::map<std::string, std::shared_ptr<AbstractType>> _types;
+    std::map<std::string, unsigned int> _type_ids;
+    std::unordered_map<unsigned int, std::shared_ptr<AbstractType>> _pointer_types;
     std::map<std::string, Name> _names;
+    std::unordered_map<const Expression *, ConstantValue> _constants;
+
+    std::shared_ptr<AbstractType> _bool_type;
+    std::shared_ptr<AbstractType> _int_type;
+    std::shared_ptr<AbstractType> _float_type;
+    std::shared_ptr<AbstractType> _char_type;
+    std::shared_ptr<AbstractType> _string_type;
+
+    auto internType(AbstractType *type) -> void;
+
+    [[nodiscard]] static auto computeTraits(const AbstractType *type) -> TypeTraits;
 };
 }
 
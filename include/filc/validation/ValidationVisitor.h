@@ -26,6 +26,8 @@
 
 #include "filc/grammar/Position.h"
 #include "filc/grammar/Visitor.h"
+#include "filc/utils/Diagnostics.h"
+#include "filc/validation/ConstantEvaluator.h"
 #include "filc/validation/Environment.h"
 #include "filc/validation/TypeBuilder.h"
 
@@ -33,9 +35,16 @@
 #include <string>
 
 namespace filc {
+struct ValidationFrame {
+    bool return_used = false;
+    std::shared_ptr<AbstractType> cast_type;
+    bool has_array_size      = false;
+    unsigned long array_size = 0;
+};
+
 class ValidationVisitor final : public Visitor<void> {
   public:
-    explicit ValidationVisitor(std::ostream &out);
+    explicit ValidationVisitor(Diagnostics &diagnostics);
 
     [[nodiscard]] auto getEnvironment() const -> const Environment *;
 
@@ -72,15 +81,25 @@ class ValidationVisitor final : public Visitor<void> {
     auto visitArrayAccess(ArrayAccess *array_access) -> void override;
 
   private:
-    std::unique_ptr<VisitorContext> _context;
+    VisitorContext<ValidationFrame> _context;
     std::unique_ptr<Environment> _environment;
     TypeBuilder _type_builder;
-    std::ostream &_out;
-    bool _error;
+    ConstantEvaluator _evaluator;
+    Diagnostics &_diagnostics;
+
+    auto displayError(const std::string &code, const std::string &message, const Position &position) -> void;
+
+    /**
+     * Validate the right operand and the operation of calcul, its left operand is already validated
+     */
+    auto validateOperation(BinaryCalcul *calcul) -> void;
 
-    auto displayError(const std::string &message, const Position &position) -> void;
+    /**
+     * Replace the val naming the size of array type_name by its value, false if it is not a valid size
+     */
+    auto resolveArraySize(std::string &type_name, const Position &position) -> bool;
 
-    auto displayWarning(const std::string &message, const Position &position) const -> void;
+    auto displayWarning(const std::string &code, const char *message, const Position &position) -> void;
 };
 }
 
@@ -22,9 +22,9 @@
  * SOFTWARE.
  */
 #include <filc/filc.h>
+#include <iostream>
 
 auto main(int argc, char **argv) -> int {
-    auto compiler
-        = filc::FilCompiler(filc::OptionsParser(), filc::DumpVisitor(std::cout), filc::ValidationVisitor(std::cout));
+    auto compiler = filc::FilCompiler(filc::OptionsParser(), std::cout);
     return compiler.run(argc, argv);
 }
@@ -0,0 +1,269 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2025-Present Kevin Traini
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "filc/cache/ObjectCache.h"
+
+#include <algorithm>
+#include <fcntl.h>
+#include <filesystem>
+#include <fstream>
+#include <llvm/ADT/StringExtras.h>
+#include <llvm/Support/SHA256.h>
+#include <sstream>
+#include <sys/file.h>
+#include <sys/ioctl.h>
+#include <sys/stat.h>
+#include <thread>
+#include <unistd.h>
+#include <utility>
+#ifdef __linux__
+#include <linux/fs.h>
+#endif
+
+using namespace filc;
+
+namespace {
+// Try a copy-on-write clone first, it costs no data copy on filesystems supporting it (btrfs, xfs, ...)
+auto copyFile(const std::string &from, const std::string &to) -> bool {
+#ifdef FICLONE
+    const auto in = open(from.c_str(), O_RDONLY);
+    if (in < 0) {
+        return false;
+    }
+    struct stat status {};
+    fstat(in, &status);
+    const auto out = open(to.c_str(), O_WRONLY | O_CREAT | O_TRUNC, status.st_mode & 0777);
+    const auto cloned = out >= 0 && ioctl(out, FICLONE, in) == 0;
+    close(in);
+    if (out >= 0) {
+        close(out);
+    }
+    if (cloned) {
+        return true;
+    }
+#endif
+
+    std::error_code ec;
+    std::filesystem::copy_file(from, to, std::filesystem::copy_options::overwrite_existing, ec);
+    return ! ec;
+}
+
+// Diagnostics reported by the compilation of an entry are stored next to it, an entry without them is incomplete
+const std::string DIAGNOSTICS_EXTENSION = ".diagnostics";
+
+auto isDiagnosticsFile(const std::filesystem::path &file) -> bool {
+    return file.extension() == DIAGNOSTICS_EXTENSION;
+}
+
+// Files are written aside then renamed, so that a concurrent fetch never sees a partial one
+auto getTemporaryPath(const std::string &file) -> std::string {
+    std::stringstream temporary;
+    temporary << file << ".tmp" << getpid() << "." << std::this_thread::get_id();
+    return temporary.str();
+}
+
+auto moveFile(const std::string &from, const std::string &to) -> bool {
+    std::error_code ec;
+    std::filesystem::rename(from, to, ec);
+    if (ec) {
+        std::filesystem::remove(from, ec);
+        return false;
+    }
+    return true;
+}
+
+auto readStatistics(const std::filesystem::path &file, unsigned long &hits, unsigned long &misses) -> void {
+    hits   = 0;
+    misses = 0;
+    std::ifstream in(file);
+    in >> hits >> misses;
+}
+
+class FileLock final {
+  public:
+    explicit FileLock(const std::filesystem::path &file): _fd(open(file.c_str(), O_RDWR | O_CREAT, 0644)) {
+        if (_fd >= 0) {
+            flock(_fd, LOCK_EX);
+        }
+    }
+
+    FileLock(const FileLock &other) = delete;
+
+    auto operator=(const FileLock &other) -> FileLock & = delete;
+
+    ~FileLock() {
+        if (_fd >= 0) {
+            flock(_fd, LOCK_UN);
+            close(_fd);
+        }
+    }
+
+  private:
+    int _fd;
+};
+} // namespace
+
+ObjectCache::ObjectCache(std::string directory, const std::uintmax_t max_size)
+    : _directory(std::move(directory)), _max_size(max_size), _hits(0), _misses(0) {
+    std::filesystem::create_directories(std::filesystem::path(_directory) / "objects");
+}
+
+auto ObjectCache::computeKey(const std::string &source, const std::vector<std::string> &options) -> std::string {
+    llvm::SHA256 hasher;
+    hasher.update(source);
+    for (const auto &option : options) {
+        // Separator so that {"ab", "c"} and {"a", "bc"} give different keys
+        hasher.update(llvm::StringRef("\0", 1));
+        hasher.update(option);
+    }
+
+    return llvm::toHex(hasher.final(), true);
+}
+
+auto ObjectCache::fetch(const std::string &key, const std::string &output_file, std::string &diagnostics) -> bool {
+    const auto entry             = getEntryPath(key);
+    const auto diagnostics_entry = getDiagnosticsPath(key);
+    std::ifstream diagnostics_in(diagnostics_entry, std::ios::binary);
+    if (! diagnostics_in || ! std::filesystem::exists(entry) || ! copyFile(entry, output_file)) {
+        _misses++;
+        return false;
+    }
+    diagnostics.assign(std::istreambuf_iterator<char>(diagnostics_in), std::istreambuf_iterator<char>());
+
+    // Modification time is used as last access time for eviction
+    std::error_code ec;
+    const auto now = std::filesystem::file_time_type::clock::now();
+    std::filesystem::last_write_time(entry, now, ec);
+    std::filesystem::last_write_time(diagnostics_entry, now, ec);
+    _hits++;
+
+    return true;
+}
+
+auto ObjectCache::store(const std::string &key, const std::string &output_file, const std::string &diagnostics)
+    -> void {
+    // Diagnostics are written last, so that the entry is only fetched once it is complete
+    const auto entry           = getEntryPath(key);
+    const auto entry_temporary = getTemporaryPath(entry);
+    if (! copyFile(output_file, entry_temporary) || ! moveFile(entry_temporary, entry)) {
+        return;
+    }
+
+    const auto diagnostics_entry     = getDiagnosticsPath(key);
+    const auto diagnostics_temporary = getTemporaryPath(diagnostics_entry);
+    std::ofstream diagnostics_out(diagnostics_temporary, std::ios::binary);
+    diagnostics_out << diagnostics;
+    diagnostics_out.close();
+    if (! diagnostics_out) {
+        std::error_code ec;
+        std::filesystem::remove(diagnostics_temporary, ec);
+        return;
+    }
+    moveFile(diagnostics_temporary, diagnostics_entry);
+}
+
+auto ObjectCache::flush() -> void {
+    const std::filesystem::path directory(_directory);
+    const FileLock lock(directory / "lock");
+
+    unsigned long hits;
+    unsigned long misses;
+    readStatistics(directory / "statistics", hits, misses);
+    std::ofstream(directory / "statistics") << hits + _hits.exchange(0) << " " << misses + _misses.exchange(0) << "\n";
+
+    std::vector<std::pair<std::filesystem::file_time_type, std::filesystem::directory_entry>> entries;
+    std::uintmax_t size = 0;
+    for (const auto &entry : std::filesystem::directory_iterator(directory / "objects")) {
+        if (entry.is_regular_file()) {
+            if (! isDiagnosticsFile(entry.path())) {
+                entries.emplace_back(entry.last_write_time(), entry);
+            }
+            size += entry.file_size();
+        }
+    }
+    if (size <= _max_size) {
+        return;
+    }
+
+    std::sort(entries.begin(), entries.end(), [](const auto &a, const auto &b) {
+        return a.first < b.first;
+    });
+    for (const auto &[last_access, entry] : entries) {
+        if (size <= _max_size) {
+            break;
+        }
+        size -= entry.file_size();
+        std::error_code ec;
+        std::filesystem::remove(entry.path(), ec);
+        const std::filesystem::path diagnostics_entry(getDiagnosticsPath(entry.path().filename().string()));
+        const auto diagnostics_size = std::filesystem::file_size(diagnostics_entry, ec);
+        if (! ec && std::filesystem::remove(diagnostics_entry, ec)) {
+            size -= diagnostics_size;
+        }
+    }
+}
+
+auto ObjectCache::getHits() const -> unsigned long {
+    return _hits;
+}
+
+auto ObjectCache::getMisses() const -> unsigned long {
+    return _misses;
+}
+
+auto ObjectCache::showStatistics(std::ostream &out) const -> void {
+    const std::filesystem::path directory(_directory);
+    unsigned long hits;
+    unsigned long misses;
+    readStatistics(directory / "statistics", hits, misses);
+    hits   += _hits;
+    misses += _misses;
+
+    unsigned long count = 0;
+    std::uintmax_t size = 0;
+    for (const auto &entry : std::filesystem::directory_iterator(directory / "objects")) {
+        if (entry.is_regular_file()) {
+            if (! isDiagnosticsFile(entry.path())) {
+                count++;
+            }
+            size += entry.file_size();
+        }
+    }
+
+    out << "Cache directory: " << _directory << "\n";
+    out << "Entries: " << count << "\n";
+    out << "Size: " << size << " / " << _max_size << " bytes\n";
+    out << "Hits: " << hits << "\n";
+    out << "Misses: " << misses << "\n";
+    if (hits + misses > 0) {
+        out << "Hit rate: " << 100 * hits / (hits + misses) << "%\n";
+    }
+}
+
+auto ObjectCache::getEntryPath(const std::string &key) const -> std::string {
+    return (std::filesystem::path(_directory) / "objects" / key).string();
+}
+
+auto ObjectCache::getDiagnosticsPath(const std::string &key) const -> std::string {
+    return getEntryPath(key) + DIAGNOSTICS_EXTENSION;
+}
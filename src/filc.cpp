@@ -23,62 +23,387 @@
  */
 #include "filc/filc.h"
 
+#include "filc/grammar/DumpVisitor.h"
 #include "filc/grammar/Parser.h"
 #include "filc/grammar/program/Program.h"
 #include "filc/llvm/IRGenerator.h"
+#include "filc/server/CompilerServer.h"
+#include "filc/utils/Diagnostics.h"
+#include "filc/utils/TimeReport.h"
+#include "filc/validation/ValidationVisitor.h"
 
+#include <algorithm>
+#include <atomic>
+#include <exception>
 #include <filesystem>
+#include <fstream>
 #include <iostream>
+#include <llvm/IR/PassTimingInfo.h>
+#include <llvm/Pass.h>
+#include <llvm/Support/raw_ostream.h>
+#include <sstream>
+#include <thread>
 #include <utility>
+#include <vector>
 
 using namespace filc;
 
 FilCompiler::FilCompiler(
-    OptionsParser options_parser, DumpVisitor ast_dump_visitor, ValidationVisitor validation_visitor
+    OptionsParser options_parser, std::ostream &out, std::ostream &err, std::filesystem::path base_directory
 )
-    : _options_parser(std::move(options_parser)), _ast_dump_visitor(std::move(ast_dump_visitor)),
-      _validation_visitor(std::move(validation_visitor)) {}
+    : _options_parser(std::move(options_parser)), _out(out), _err(err), _base_directory(std::move(base_directory)) {}
 
 auto FilCompiler::run(int argc, char **argv) -> int {
     _options_parser.parse(argc, argv);
     if (_options_parser.isHelp()) {
-        _options_parser.showHelp(std::cout);
+        _options_parser.showHelp(_out);
         return 0;
     }
     if (_options_parser.isVersion()) {
-        OptionsParser::showVersion(std::cout);
+        OptionsParser::showVersion(_out);
         return 0;
     }
 
-    const auto filename = _options_parser.getFile();
-    if (! std::filesystem::exists(filename) || ! std::filesystem::is_regular_file(filename)) {
-        std::cerr << "File " << filename << " not found";
+    const auto server_socket = _options_parser.getServerSocket();
+    if (! server_socket.empty()) {
+        CompilerServer server(server_socket);
+        const auto status = server.open();
+        return status != 0 ? status : server.serve();
+    }
+    // A run executes the program, it is compiled here so that the program runs in the process of the user
+    const auto connect_socket = _options_parser.getConnectSocket();
+    if (! connect_socket.empty() && ! _options_parser.isRun()) {
+        std::vector<std::string> arguments;
+        for (int i = 0; i < argc; i++) {
+            const std::string argument = argv[i];
+            if (argument == "--connect" && i + 1 < argc && argv[i + 1] == connect_socket) {
+                // The socket is a separate argument
+                i++;
+            } else if (argument.rfind("--connect", 0) != 0) {
+                arguments.push_back(argument);
+            }
+        }
+        return CompilerClient(connect_socket).send(arguments, _out, _err);
+    }
+
+    const auto cache_directory = _options_parser.getCacheDirectory();
+    if (! cache_directory.empty()) {
+        _cache = std::make_unique<ObjectCache>(
+            resolvePath(cache_directory), _options_parser.getCacheSize() * 1024 * 1024
+        );
+    }
+    if (_options_parser.isCacheStats()) {
+        if (_cache == nullptr) {
+            _err << "--cache-stats needs a --cache-dir";
+            return 1;
+        }
+        _cache->showStatistics(_out);
+        return 0;
+    }
+
+    auto files = _options_parser.getFiles();
+    if (files.empty()) {
+        _err << "No input file";
+        return 1;
+    }
+    for (auto &filename : files) {
+        filename = resolvePath(filename);
+        if (! std::filesystem::exists(filename) || ! std::filesystem::is_regular_file(filename)) {
+            _err << "File " << filename << " not found";
+            return 1;
+        }
+    }
+    const auto emit = _options_parser.getEmit();
+    llvm::TimePassesIsEnabled = _options_parser.isTimeReport();
+
+    if (files.size() == 1) {
+        const auto output_file = resolvePath(_options_parser.getOutputFile());
+        auto diagnostics       = makeDiagnostics(_out);
+        const auto status      = compile(files.front(), output_file, _out, _err, diagnostics);
+        if (_cache != nullptr) {
+            _cache->flush();
+        }
+        Diagnostics::writeSarifLog(_out, {&diagnostics});
+        return status;
+    }
+    if (_options_parser.isRun()) {
+        _err << "Only one file can be run at a time";
+        return 1;
+    }
+    if (_options_parser.isOutputFileSet()) {
+        _err << "-o can only be used with a single input file";
         return 1;
     }
-    const auto dump_option = _options_parser.getDump();
 
-    const auto program = ParserProxy::parse(filename);
+    // Each file has its own parser, environment and LLVM context, so the whole pipeline runs on a worker thread.
+    // Outputs and errors are buffered per file and written in command line order.
+    std::vector<std::stringstream> outputs(files.size());
+    std::vector<std::stringstream> error_outputs(files.size());
+    std::vector<Diagnostics> diagnostics;
+    diagnostics.reserve(files.size());
+    for (auto &output : outputs) {
+        diagnostics.push_back(makeDiagnostics(output));
+    }
+    std::vector<int> statuses(files.size(), 0);
+    std::vector<std::exception_ptr> errors(files.size());
+    std::atomic<std::size_t> next_file(0);
+    const auto worker = [&] {
+        for (auto i = next_file++; i < files.size(); i = next_file++) {
+            try {
+                statuses[i] = compile(
+                    files[i], getOutputFile(files[i], emit), outputs[i], error_outputs[i], diagnostics[i]
+                );
+            } catch (...) {
+                errors[i] = std::current_exception();
+            }
+        }
+    };
+
+    auto jobs = _options_parser.getJobs();
+    if (jobs == 0) {
+        jobs = std::max(1U, std::thread::hardware_concurrency());
+    }
+    if (llvm::TimePassesIsEnabled) {
+        // LLVM pass timers are shared by the whole process
+        jobs = 1;
+    }
+    std::vector<std::thread> workers;
+    for (std::size_t i = 1; i < std::min<std::size_t>(jobs, files.size()); i++) {
+        workers.emplace_back(worker);
+    }
+    worker();
+    for (auto &thread : workers) {
+        thread.join();
+    }
+
+    if (_cache != nullptr) {
+        _cache->flush();
+    }
+
+    int status = 0;
+    for (std::size_t i = 0; i < files.size(); i++) {
+        _out << outputs[i].str();
+        _err << error_outputs[i].str();
+        if (errors[i] != nullptr) {
+            std::rethrow_exception(errors[i]);
+        }
+        if (statuses[i] != 0) {
+            status = statuses[i];
+        }
+    }
+
+    std::vector<const Diagnostics *> all_diagnostics;
+    for (const auto &file_diagnostics : diagnostics) {
+        all_diagnostics.push_back(&file_diagnostics);
+    }
+    Diagnostics::writeSarifLog(_out, all_diagnostics);
+
+    return status;
+}
+
+auto FilCompiler::compile(
+    const std::string &filename,
+    const std::string &output_file,
+    std::ostream &out,
+    std::ostream &err,
+    Diagnostics &diagnostics
+) const -> int {
+    const auto time_report_enabled = _options_parser.isTimeReport();
+    const auto time_trace_enabled  = _options_parser.isTimeTrace();
+    if (! time_report_enabled && ! time_trace_enabled) {
+        return compile(filename, output_file, out, err, diagnostics, nullptr);
+    }
+
+    TimeReport time_report(filename);
+    const auto status = compile(filename, output_file, out, err, diagnostics, &time_report);
+    if (time_report_enabled) {
+        // Code generation runs on the legacy pass manager, whose timers are global
+        std::string codegen_timings;
+        llvm::raw_string_ostream codegen_timings_out(codegen_timings);
+        llvm::reportAndResetTimings(&codegen_timings_out);
+        time_report.addSection("LLVM code generation passes", codegen_timings);
+        time_report.write(out);
+    }
+    if (time_trace_enabled) {
+        std::ofstream trace(std::filesystem::path(output_file).replace_extension(".json"));
+        time_report.writeTrace(trace);
+    }
+
+    return status;
+}
+
+auto FilCompiler::compile(
+    const std::string &filename,
+    const std::string &output_file,
+    std::ostream &out,
+    std::ostream &err,
+    Diagnostics &diagnostics,
+    TimeReport *time_report
+) const -> int {
+    const auto dump_option        = _options_parser.getDump();
+    const auto optimization_level = _options_parser.getOptimizationLevel();
+
+    // Dumps and runs have side effects a cached output can't replay. Diagnostics are stored with the output and
+    // reported again on a hit, -Werror and the limit then apply as for a full compilation.
+    SourceManager sources;
+    std::string cache_key;
+    if (_cache != nullptr && dump_option == "none" && ! _options_parser.isRun()) {
+        TimeScope cache_lookup(time_report, "Cache lookup");
+        cache_key = computeCacheKey(filename);
+        std::string cached_diagnostics;
+        if (! cache_key.empty() && _cache->fetch(cache_key, output_file, cached_diagnostics)) {
+            diagnostics.replay(cached_diagnostics, sources.load(filename));
+            diagnostics.flush();
+            if (diagnostics.hasError()) {
+                // A failing compilation leaves no output
+                std::error_code ec;
+                std::filesystem::remove(output_file, ec);
+                return 1;
+            }
+            return 0;
+        }
+        diagnostics.recordReported();
+    }
+
+    const auto program = ParserProxy::parse(filename, sources, time_report, &diagnostics);
+    diagnostics.flush();
+    if (diagnostics.hasError()) {
+        return 1;
+    }
     if (dump_option == "ast" || dump_option == "all") {
-        program->acceptVoidVisitor(&_ast_dump_visitor);
+        DumpVisitor ast_dump_visitor(out);
+        program->acceptVoidVisitor(&ast_dump_visitor);
         if (dump_option == "ast") {
             return 0;
         }
     }
 
-    program->acceptVoidVisitor(&_validation_visitor);
-    if (_validation_visitor.hasError()) {
+    TimeScope validation(time_report, "Validation");
+    ValidationVisitor validation_visitor(diagnostics);
+    program->acceptVoidVisitor(&validation_visitor);
+    diagnostics.flush();
+    validation.stop();
+    if (validation_visitor.hasError()) {
         return 1;
     }
 
-    IRGenerator generator(filename, _validation_visitor.getEnvironment());
+    TimeScope ir_generation(time_report, "IR generation");
+    IRGenerator generator(filename, validation_visitor.getEnvironment(), err);
     program->acceptIRVisitor(&generator);
+    ir_generation.stop();
+    if (time_report != nullptr) {
+        const auto &strings = generator.getStringPoolStats();
+        time_report->setCounter("String literals", strings.literals);
+        time_report->setCounter("String globals", strings.globals);
+        time_report->setCounter("String bytes pooled", strings.saved_bytes);
+    }
+
+    TimeScope target_setup(time_report, "Target setup");
+    const auto target_status = generator.setupTarget(
+        _options_parser.getTarget(), _options_parser.getCpu(), _options_parser.getCpuFeatures(), optimization_level
+    );
+    target_setup.stop();
+    if (target_status != 0) {
+        return target_status;
+    }
+
+    TimeScope optimization(time_report, "Optimization");
+    std::string pass_timings;
+    llvm::raw_string_ostream pass_timings_out(pass_timings);
+    generator.optimize(time_report != nullptr ? &pass_timings_out : nullptr);
+    optimization.stop();
+    if (time_report != nullptr) {
+        time_report->addSection("LLVM optimization passes", pass_timings);
+    }
     if (dump_option == "ir" || dump_option == "all") {
-        const auto ir_result = generator.dump();
-        std::cout << ir_result;
+        out << generator.dump();
         if (dump_option == "ir") {
             return 0;
         }
     }
 
-    return generator.toTarget(_options_parser.getOutputFile(), _options_parser.getTarget());
+    if (_options_parser.isRun()) {
+        TimeScope run(time_report, "JIT run");
+        return generator.run();
+    }
+
+    TimeScope code_generation(time_report, "Code generation");
+    const auto status = generator.toTarget(output_file, _options_parser.getEmit());
+    code_generation.stop();
+    if (status == 0 && ! cache_key.empty()) {
+        _cache->store(cache_key, output_file, diagnostics.serializeReported());
+    }
+
+    return status;
+}
+
+auto FilCompiler::computeCacheKey(const std::string &filename) const -> std::string {
+    std::ifstream file(filename, std::ios::binary);
+    const std::string source((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+
+    // Invalid target options are reported by the compilation itself
+    std::string error;
+    const auto target = IRGenerator::resolveTarget(
+        _options_parser.getTarget(), _options_parser.getCpu(), _options_parser.getCpuFeatures(), error
+    );
+    if (! error.empty()) {
+        return "";
+    }
+    // Disabled warnings are never reported, so they are not in the stored diagnostics. -Werror and the limit apply
+    // when the stored diagnostics are replayed.
+    auto disabled_warnings = _options_parser.getDisabledWarnings();
+    std::sort(disabled_warnings.begin(), disabled_warnings.end());
+    std::string warning_options = _options_parser.isWarningsDisabled() ? "-w" : "";
+    for (const auto &code : disabled_warnings) {
+        warning_options += " -Wno-" + code;
+    }
+    // The filename is the module name, written in the outputs as ModuleID, source_filename or file symbol
+    return ObjectCache::computeKey(
+        source,
+        {FILC_VERSION,
+         filename,
+         target.triple,
+         target.cpu,
+         target.features,
+         _options_parser.getOptimizationLevel(),
+         _options_parser.getEmit(),
+         warning_options}
+    );
+}
+
+auto FilCompiler::makeDiagnostics(std::ostream &out) const -> Diagnostics {
+    Diagnostics diagnostics(out, Diagnostics::getFormat(_options_parser.getDiagnosticsFormat()));
+    if (_options_parser.isWarningsDisabled()) {
+        diagnostics.disableWarnings();
+    }
+    for (const auto &code : _options_parser.getDisabledWarnings()) {
+        diagnostics.disableWarning(code);
+    }
+    diagnostics.setWarningsAsErrors(_options_parser.isWarningsAsErrors());
+    diagnostics.setMaxDiagnostics(_options_parser.getMaxDiagnostics());
+
+    return diagnostics;
+}
+
+auto FilCompiler::resolvePath(const std::string &path) const -> std::string {
+    if (_base_directory.empty() || path.empty() || std::filesystem::path(path).is_absolute()) {
+        return path;
+    }
+
+    return (_base_directory / path).string();
+}
+
+auto FilCompiler::getOutputFile(const std::string &filename, const std::string &emit) -> std::string {
+    std::filesystem::path output_file(filename);
+    if (emit == "exe") {
+        output_file.replace_extension();
+    } else if (emit == "obj") {
+        output_file.replace_extension(".o");
+    } else if (emit == "asm") {
+        output_file.replace_extension(".s");
+    } else {
+        output_file.replace_extension("." + emit);
+    }
+
+    return output_file.string();
 }
@@ -127,7 +127,7 @@ auto DumpVisitor::visitVariableDeclaration(VariableDeclaration *variable) -> voi
 
 auto DumpVisitor::visitBinaryCalcul(BinaryCalcul *calcul) -> void {
     printIdent();
-    _out << "[BinaryCalcul:" << calcul->getOperator() << "]\n";
+    _out << "[BinaryCalcul:" << toString(calcul->getOperator()) << "]\n";
     _indent_level++;
     calcul->getLeftExpression()->acceptVoidVisitor(this);
     calcul->getRightExpression()->acceptVoidVisitor(this);
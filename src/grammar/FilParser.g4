@@ -33,26 +33,94 @@ options {
 #include "filc/grammar/program/Program.h"
 #include "filc/grammar/variable/Variable.h"
 #include "filc/grammar/calcul/Calcul.h"
+#include "filc/grammar/calcul/BinaryCalculBuilder.h"
 #include "filc/grammar/identifier/Identifier.h"
 #include "filc/grammar/assignation/Assignation.h"
 #include "filc/grammar/pointer/Pointer.h"
 #include "filc/grammar/array/Array.h"
+#include "filc/utils/Arena.h"
 #include <memory>
+#include <stdexcept>
 #include <vector>
 }
 
+@parser::members {
+    filc::Arena *_arena = nullptr;
+
+    static auto toBinaryOperator(size_t token_type) -> filc::BinaryOperator {
+        switch (token_type) {
+            case MOD:
+            case MOD_EQ:
+                return filc::BinaryOperator::MOD;
+            case PLUS:
+            case PLUS_EQ:
+                return filc::BinaryOperator::PLUS;
+            case MINUS:
+            case MINUS_EQ:
+                return filc::BinaryOperator::MINUS;
+            case DIV:
+            case DIV_EQ:
+                return filc::BinaryOperator::DIV;
+            case STAR:
+            case STAR_EQ:
+                return filc::BinaryOperator::STAR;
+            case LT:
+                return filc::BinaryOperator::LT;
+            case LTE:
+                return filc::BinaryOperator::LTE;
+            case GT:
+                return filc::BinaryOperator::GT;
+            case GTE:
+                return filc::BinaryOperator::GTE;
+            case EQEQ:
+                return filc::BinaryOperator::EQEQ;
+            case NEQ:
+                return filc::BinaryOperator::NEQ;
+            case AND:
+            case AND_EQ:
+                return filc::BinaryOperator::AND;
+            case OR:
+            case OR_EQ:
+                return filc::BinaryOperator::OR;
+            default:
+                throw std::logic_error("Token is not a binary operator");
+        }
+    }
+}
+
 program returns[std::shared_ptr<filc::Program> tree]
 @init {
-    std::vector<std::shared_ptr<filc::Expression>> expressions;
-}
-@after {
-    $tree = std::make_shared<filc::Program>(expressions);
+    $tree = std::make_shared<filc::Program>();
+    _arena = &$tree->getArena();
 }
     : (e=expression {
-        expressions.push_back($e.tree);
+        $tree->addExpression($e.tree);
     } SEMI?)* EOF;
 
-expression returns[std::shared_ptr<filc::Expression> tree]
+// Binary calculs are parsed as a flat sequence of operands, grouped by BinaryCalculBuilder according to operator
+// precedence. Long chains then neither recurse in the parser nor depend on adaptive prediction of a left-recursive rule.
+expression returns[filc::Expression *tree]
+@init {
+    filc::BinaryCalculBuilder calcul_builder(_arena);
+}
+    : l=operand {
+        calcul_builder.pushOperand($l.tree, $l.start, $l.stop);
+    } (op=(MOD | DIV | STAR | PLUS | MINUS | LT | GT | LTE | GTE | EQEQ | NEQ | AND | OR) r=operand {
+        calcul_builder.pushOperator(toBinaryOperator($op.type));
+        calcul_builder.pushOperand($r.tree, $r.start, $r.stop);
+    })* {
+        $tree = calcul_builder.build();
+    };
+
+operand returns[filc::Expression *tree]
+    : p=primary {
+        $tree = $p.tree;
+    } (LBRACK n=INTEGER rb=RBRACK {
+        $tree = _arena->make<filc::ArrayAccess>($tree, stoi($n.text));
+        $tree->setPosition(filc::Position($p.start, $rb));
+    })*;
+
+primary returns[filc::Expression *tree]
 @after {
     $tree->setPosition(filc::Position($ctx->start, $ctx->stop));
 }
@@ -62,11 +130,8 @@ expression returns[std::shared_ptr<filc::Expression> tree]
     | v=variable_declaration {
         $tree = $v.tree;
     }
-    | ea=expression LBRACK n=INTEGER RBRACK {
-        $tree = std::make_shared<filc::ArrayAccess>($ea.tree, stoi($n.text));
-    }
     | i=IDENTIFIER {
-        $tree = std::make_shared<filc::Identifier>($i.text);
+        $tree = _arena->make<filc::Identifier>($i.text);
     }
     | p=pointer {
         $tree = $p.tree;
@@ -77,25 +142,6 @@ expression returns[std::shared_ptr<filc::Expression> tree]
     | ar=array {
         $tree = $ar.tree;
     }
-
-    // === Binary calcul ===
-    | el3=expression op3=MOD er3=expression {
-        $tree = std::make_shared<filc::BinaryCalcul>($el3.tree, $op3.text, $er3.tree);
-    }
-    | el4=expression op4=(DIV | STAR) er4=expression {
-        $tree = std::make_shared<filc::BinaryCalcul>($el4.tree, $op4.text, $er4.tree);
-    }
-    | el5=expression op5=(PLUS | MINUS) er5=expression {
-        $tree = std::make_shared<filc::BinaryCalcul>($el5.tree, $op5.text, $er5.tree);
-    }
-    | el2=expression op2=(LT | GT | LTE | GTE | EQEQ | NEQ) er2=expression {
-        $tree = std::make_shared<filc::BinaryCalcul>($el2.tree, $op2.text, $er2.tree);
-    }
-    | el1=expression op1=(AND | OR) er1=expression {
-        $tree = std::make_shared<filc::BinaryCalcul>($el1.tree, $op1.text, $er1.tree);
-    }
-    // === Binary calcul ===
-
     | LPAREN e=expression RPAREN {
         $tree = $e.tree;
     }
@@ -103,7 +149,7 @@ expression returns[std::shared_ptr<filc::Expression> tree]
        $tree = $a.tree;
     };
 
-literal returns[std::shared_ptr<filc::Expression> tree]
+literal returns[filc::Expression *tree]
     : b=boolean {
         $tree = $b.tree;
     }
@@ -111,21 +157,21 @@ literal returns[std::shared_ptr<filc::Expression> tree]
         $tree = $n.tree;
     }
     | c=CHARACTER {
-        $tree = std::make_shared<filc::CharacterLiteral>(filc::CharacterLiteral::stringToChar($c.text));
+        $tree = _arena->make<filc::CharacterLiteral>(filc::CharacterLiteral::stringToChar($c.text));
     }
     | s=STRING {
-        $tree = std::make_shared<filc::StringLiteral>($s.text);
+        $tree = _arena->make<filc::StringLiteral>($s.text);
     };
 
-boolean returns[std::shared_ptr<filc::BooleanLiteral> tree]
+boolean returns[filc::BooleanLiteral *tree]
     : TRUE {
-        $tree = std::make_shared<filc::BooleanLiteral>(true);
+        $tree = _arena->make<filc::BooleanLiteral>(true);
     }
     | FALSE {
-        $tree = std::make_shared<filc::BooleanLiteral>(false);
+        $tree = _arena->make<filc::BooleanLiteral>(false);
     };
 
-number returns[std::shared_ptr<filc::Expression> tree]
+number returns[filc::Expression *tree]
 @init {
     bool is_negative = false;
 }
@@ -136,24 +182,24 @@ number returns[std::shared_ptr<filc::Expression> tree]
         if (is_negative) {
             ivalue = -ivalue;
         }
-        $tree = std::make_shared<filc::IntegerLiteral>(ivalue);
+        $tree = _arena->make<filc::IntegerLiteral>(ivalue);
     }
     | f=FLOAT {
         auto fvalue = stod($f.text);
         if (is_negative) {
             fvalue = -fvalue;
         }
-        $tree = std::make_shared<filc::FloatLiteral>(fvalue);
+        $tree = _arena->make<filc::FloatLiteral>(fvalue);
     });
 
-variable_declaration returns[std::shared_ptr<filc::VariableDeclaration> tree]
+variable_declaration returns[filc::VariableDeclaration *tree]
 @init {
     bool is_constant = true;
     std::string type_name;
-    std::shared_ptr<filc::Expression> value = nullptr;
+    filc::Expression *value = nullptr;
 }
 @after {
-    $tree = std::make_shared<filc::VariableDeclaration>(is_constant, $name.text, type_name, value);
+    $tree = _arena->make<filc::VariableDeclaration>(is_constant, $name.text, type_name, value);
 }
     : (VAL | VAR {
         is_constant = false;
@@ -163,49 +209,41 @@ variable_declaration returns[std::shared_ptr<filc::VariableDeclaration> tree]
         value = $value.tree;
     })?;
 
-type : IDENTIFIER (STAR | LBRACK INTEGER RBRACK)?;
+type : IDENTIFIER (STAR | LBRACK (INTEGER | IDENTIFIER) RBRACK)?;
 
-assignation returns[std::shared_ptr<filc::Assignation> tree]
+assignation returns[filc::Assignation *tree]
     : i1=IDENTIFIER EQ e1=expression {
-        $tree = std::make_shared<filc::Assignation>($i1.text, $e1.tree);
+        $tree = _arena->make<filc::Assignation>($i1.text, $e1.tree);
     }
     | i2=IDENTIFIER op=(PLUS_EQ | MINUS_EQ | STAR_EQ | DIV_EQ | MOD_EQ | AND_EQ | OR_EQ) e2=expression {
-        const auto calcul = std::make_shared<filc::BinaryCalcul>(std::make_shared<filc::Identifier>($i2.text), $op.text.substr(0, $op.text.size() - 1), $e2.tree);
+        const auto calcul = _arena->make<filc::BinaryCalcul>(_arena->make<filc::Identifier>($i2.text), toBinaryOperator($op.type), $e2.tree);
         calcul->setPosition(filc::Position($op, $e2.stop));
-        $tree = std::make_shared<filc::Assignation>($i2.text, calcul);
+        $tree = _arena->make<filc::Assignation>($i2.text, calcul);
     };
 
-pointer returns[std::shared_ptr<filc::Pointer> tree]
+pointer returns[filc::Pointer *tree]
     : NEW t=IDENTIFIER LPAREN e=expression RPAREN {
-        $tree = std::make_shared<filc::Pointer>($t.text, $e.tree);
+        $tree = _arena->make<filc::Pointer>($t.text, $e.tree);
     };
 
-pointer_operation returns[std::shared_ptr<filc::Expression> tree]
+pointer_operation returns[filc::Expression *tree]
     : STAR e=expression {
-        $tree = std::make_shared<filc::PointerDereferencing>($e.tree);
+        $tree = _arena->make<filc::PointerDereferencing>($e.tree);
     }
     | AMP e=expression {
-        $tree = std::make_shared<filc::VariableAddress>($e.tree);
+        $tree = _arena->make<filc::VariableAddress>($e.tree);
     };
 
-array returns[std::shared_ptr<filc::Array> tree]
+// Values are collected by a loop in a single vector, large lookup tables are parsed in linear time without recursion
+array returns[filc::Array *tree]
 @init {
-    std::vector<std::shared_ptr<filc::Expression>> values;
+    std::vector<filc::Expression *> values;
 }
 @after {
-    $tree = std::make_shared<filc::Array>(values);
-}
-    : LBRACK (v=array_values {
-        values = $v.values;
-    })? RBRACK;
-
-array_values returns[std::vector<std::shared_ptr<filc::Expression>> values]
-@init {
-    $values = std::vector<std::shared_ptr<filc::Expression>>();
+    $tree = _arena->make<filc::Array>(std::move(values));
 }
-    : e=expression {
-        $values.push_back($e.tree);
-    } (COMMA v=array_values {
-        auto values_to_insert = $v.values;
-        $values.insert($values.end(), values_to_insert.begin(), values_to_insert.end());
-    })?;
+    : LBRACK (e=expression {
+        values.push_back($e.tree);
+    } (COMMA v=expression {
+        values.push_back($v.tree);
+    })*)? RBRACK;
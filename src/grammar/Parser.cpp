@@ -26,23 +26,98 @@
 #include "FilLexer.h"
 #include "FilParser.h"
 #include "antlr4-runtime.h"
-
-#include <filesystem>
+#include "filc/grammar/SourceStream.h"
+#include "filc/grammar/program/Program.h"
+#include <atomic>
+#include <memory>
 
 using namespace filc;
 
-auto ParserProxy::parse(const std::string &filename) -> std::shared_ptr<Program> {
-    if (! std::filesystem::exists(filename)) {
-        throw std::logic_error("File '" + filename + "' not found");
+namespace {
+std::atomic<size_t> full_context_parse_count {0};
+
+class DiagnosticsErrorListener final: public antlr4::BaseErrorListener {
+  public:
+    DiagnosticsErrorListener(Diagnostics &diagnostics, const SourceBuffer *source)
+        : _diagnostics(diagnostics), _source(source) {}
+
+    auto syntaxError(
+        antlr4::Recognizer * /* recognizer */,
+        antlr4::Token *offending_symbol,
+        size_t line,
+        size_t column,
+        const std::string &message,
+        std::exception_ptr /* error */
+    ) -> void override {
+        // The lexer has no token to point to when it fails
+        const auto position = offending_symbol != nullptr
+                                ? Position(offending_symbol, offending_symbol)
+                                : Position(_source, static_cast<unsigned int>(line), static_cast<unsigned int>(column));
+        _diagnostics.report(Severity::ERROR, "syntax-error", message, position);
     }
 
-    antlr4::ANTLRFileStream input;
-    input.loadFromFile(filename);
+  private:
+    Diagnostics &_diagnostics;
+    const SourceBuffer *_source;
+};
+} // namespace
+
+auto ParserProxy::parse(
+    const std::string &filename, SourceManager &sources, TimeReport *time_report, Diagnostics *diagnostics
+) -> std::shared_ptr<Program> {
+    TimeScope lexing(time_report, "Lexing");
+    const auto source = sources.load(filename);
+    SourceStream input(source);
     FilLexer lexer(&input);
+    std::unique_ptr<DiagnosticsErrorListener> error_listener;
+    if (diagnostics != nullptr) {
+        error_listener = std::make_unique<DiagnosticsErrorListener>(*diagnostics, source);
+        lexer.removeErrorListeners();
+        lexer.addErrorListener(error_listener.get());
+    }
     antlr4::CommonTokenStream tokens(&lexer);
     tokens.fill();
+    lexing.stop();
 
+    TimeScope parsing(time_report, "Parsing");
     FilParser parser(&tokens);
 
-    return parser.program()->tree;
+    // SLL prediction is much cheaper and enough for nearly every input. When it fails, because of a syntax error or
+    // of an ambiguity only full context can resolve, the file is parsed again in LL mode, which reports errors.
+    parser.getInterpreter<antlr4::atn::ParserATNSimulator>()->setPredictionMode(antlr4::atn::PredictionMode::SLL);
+    parser.removeErrorListeners();
+    parser.setErrorHandler(std::make_shared<antlr4::BailErrorStrategy>());
+
+    std::shared_ptr<Program> program;
+    auto full_context = false;
+    try {
+        program = parser.program()->tree;
+    } catch (const antlr4::ParseCancellationException &) {
+        full_context = true;
+        full_context_parse_count++;
+
+        parser.reset();
+        if (error_listener != nullptr) {
+            parser.addErrorListener(error_listener.get());
+        } else {
+            parser.addErrorListener(&antlr4::ConsoleErrorListener::INSTANCE);
+        }
+        parser.setErrorHandler(std::make_shared<antlr4::DefaultErrorStrategy>());
+        parser.getInterpreter<antlr4::atn::ParserATNSimulator>()->setPredictionMode(antlr4::atn::PredictionMode::LL);
+        program = parser.program()->tree;
+    }
+    program->setSource(source);
+    parsing.stop();
+
+    if (time_report != nullptr) {
+        time_report->setCounter("Tokens", tokens.size());
+        time_report->setCounter("Arena objects", program->getArena().getObjectCount());
+        time_report->setCounter("Full context parses", full_context ? 1 : 0);
+    }
+
+    return program;
+}
+
+auto ParserProxy::getFullContextParseCount() -> size_t {
+    return full_context_parse_count;
 }
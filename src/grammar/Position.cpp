@@ -23,26 +23,46 @@
  */
 #include "filc/grammar/Position.h"
 
-#include <fstream>
+#include "filc/grammar/SourceStream.h"
+
+#include <algorithm>
+#include <memory>
+#include <stdexcept>
 
 using namespace filc;
 
 #define RESET "\033[0m"
 
-Position::Position(): _start_position(0, 0), _end_position(0, 0) {}
-
-Position::Position(const antlr4::Token *start_token, const antlr4::Token *end_token)
-    : _filename(start_token->getTokenSource()->getSourceName()) {
-    if (end_token->getTokenSource()->getSourceName() != _filename) {
-        throw std::logic_error("start and end token are not from the same source file");
+Position::Position(): _start_position(0, 0), _end_position(0, 0), _source(nullptr) {}
+
+Position::Position(const antlr4::Token *start_token, const antlr4::Token *end_token): _source(nullptr) {
+    const auto stream = dynamic_cast<const SourceStream *>(start_token->getInputStream());
+    if (stream != nullptr && stream == end_token->getInputStream()) {
+        // The name is kept by the buffer, nothing is copied for each node
+        _source = stream->getSource();
+    } else {
+        _filename = start_token->getTokenSource()->getSourceName();
+        if (end_token->getTokenSource()->getSourceName() != _filename) {
+            throw std::logic_error("start and end token are not from the same source file");
+        }
     }
 
     _start_position = std::make_pair(start_token->getLine(), start_token->getCharPositionInLine());
     _end_position   = std::make_pair(end_token->getLine(), end_token->getCharPositionInLine());
 }
 
+Position::Position(const SourceBuffer *source, const unsigned int line, const unsigned int column)
+    : Position(source, std::make_pair(line, column), std::make_pair(line, column)) {}
+
+Position::Position(
+    const SourceBuffer *source,
+    const std::pair<unsigned int, unsigned int> start_position,
+    const std::pair<unsigned int, unsigned int> end_position
+)
+    : _start_position(start_position), _end_position(end_position), _source(source) {}
+
 auto Position::getFilename() const -> std::string {
-    return _filename;
+    return _source != nullptr ? _source->getName() : _filename;
 }
 
 auto Position::getStartPosition() const -> std::pair<unsigned int, unsigned int> {
@@ -54,34 +74,23 @@ auto Position::getEndPosition() const -> std::pair<unsigned int, unsigned int> {
 }
 
 auto Position::getContent() const -> std::vector<std::string> {
-    if (_filename.empty() || _filename == "<unknown>") {
+    if (_source == nullptr && (_filename.empty() || _filename == "<unknown>")) {
         return {};
     }
 
-    std::ifstream file(_filename);
-    if (! file.is_open() || ! file.good()) {
-        throw std::logic_error("File '" + _filename + "' not found");
+    // Positions built outside of the parser have no buffer attached
+    std::unique_ptr<SourceBuffer> opened_source;
+    auto source = _source;
+    if (source == nullptr) {
+        opened_source = SourceBuffer::open(_filename);
+        source        = opened_source.get();
     }
 
     std::vector<std::string> content;
-
-    const auto start_line = _start_position.first;
-    unsigned int index    = 0;
-    std::string line;
-    for (; index < start_line; index++) {
-        std::getline(file, line);
+    const auto end_line = std::max(_start_position.first, _end_position.first);
+    for (auto line = _start_position.first; line <= end_line; line++) {
+        content.emplace_back(source->getLine(line));
     }
-    content.push_back(line);
-
-    const auto end_line = _end_position.first;
-    if (end_line > start_line) {
-        for (; index < end_line; index++) {
-            std::getline(file, line);
-            content.push_back(line);
-        }
-    }
-
-    file.close();
 
     return content;
 }
@@ -92,6 +101,7 @@ auto Position::dump(const std::string &color) const -> std::string {
     const auto end_line     = _end_position.first;
     const auto end_column   = _end_position.second;
     const auto content      = getContent();
+    const auto filename     = getFilename();
     if (content.empty()) {
         return "";
     }
@@ -99,7 +109,7 @@ auto Position::dump(const std::string &color) const -> std::string {
     if (content.size() == 1) { // Single line
         const auto nth    = " " + std::to_string(start_line) + " ";
         const auto spaces = start_column > 0 ? std::string(start_column, ' ') : "";
-        return std::string(nth.length() - 1, ' ') + "--> " + _filename + ":" + std::to_string(start_line) + ":"
+        return std::string(nth.length() - 1, ' ') + "--> " + filename + ":" + std::to_string(start_line) + ":"
              + std::to_string(start_column) + "\n" + nth + "| " + content[0] + "\n" + std::string(nth.length(), ' ')
              + "| " + spaces + color + "^" + RESET + "\n";
     }
@@ -115,7 +125,7 @@ auto Position::dump(const std::string &color) const -> std::string {
         const auto start_spaces = start_column > 0 ? std::string(start_column, ' ') : "";
         const auto end_spaces   = end_column > 0 ? std::string(end_column, ' ') : "";
 
-        auto res = std::string(nth_end.length() - 1, ' ') + "--> " + _filename + ":" + std::to_string(start_line) + ":"
+        auto res = std::string(nth_end.length() - 1, ' ') + "--> " + filename + ":" + std::to_string(start_line) + ":"
                  + std::to_string(start_column) + "\n" + nth_spaces + start_spaces + color + "v" + RESET + "\n";
 
         for (unsigned int i = 0; i < nths.size(); i++) {
@@ -0,0 +1,94 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2025-Present Kevin Traini
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "filc/grammar/SourceStream.h"
+
+#include <algorithm>
+
+using namespace filc;
+
+SourceStream::SourceStream(const SourceBuffer *source)
+    : _source(source), _data(reinterpret_cast<const unsigned char *>(source->getContent().data())),
+      _size(source->getContent().size()), _position(0) {}
+
+auto SourceStream::getSource() const -> const SourceBuffer * {
+    return _source;
+}
+
+auto SourceStream::consume() -> void {
+    if (_position >= _size) {
+        throw antlr4::IllegalStateException("cannot consume EOF");
+    }
+    _position++;
+}
+
+auto SourceStream::LA(const ssize_t i) -> size_t {
+    if (i == 0) {
+        return 0; // Undefined
+    }
+
+    // LA(-1) is the last consumed character
+    const auto offset = static_cast<ssize_t>(_position) + (i < 0 ? i : i - 1);
+    if (offset < 0 || offset >= static_cast<ssize_t>(_size)) {
+        return antlr4::IntStream::EOF;
+    }
+
+    return _data[offset];
+}
+
+auto SourceStream::mark() -> ssize_t {
+    // The whole content is always available, there is nothing to keep
+    return -1;
+}
+
+auto SourceStream::release(ssize_t marker) -> void {}
+
+auto SourceStream::index() -> size_t {
+    return _position;
+}
+
+auto SourceStream::seek(const size_t index) -> void {
+    _position = std::min(index, _size);
+}
+
+auto SourceStream::size() -> size_t {
+    return _size;
+}
+
+auto SourceStream::getSourceName() const -> std::string {
+    return _source->getName();
+}
+
+auto SourceStream::getText(const antlr4::misc::Interval &interval) -> std::string {
+    const auto start = static_cast<size_t>(std::max<ssize_t>(interval.a, 0));
+    const auto stop  = std::min(static_cast<size_t>(std::max<ssize_t>(interval.b, -1) + 1), _size);
+    if (start >= stop) {
+        return "";
+    }
+
+    return {reinterpret_cast<const char *>(_data) + start, stop - start};
+}
+
+auto SourceStream::toString() const -> std::string {
+    return std::string(_source->getContent());
+}
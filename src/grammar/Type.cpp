@@ -28,6 +28,22 @@
 
 using namespace filc;
 
+auto TypeTraits::isInteger() const noexcept -> bool {
+    return is_signed_int || is_unsigned_int;
+}
+
+auto TypeTraits::isNumeric() const noexcept -> bool {
+    return isInteger() || is_float;
+}
+
+auto AbstractType::getId() const noexcept -> unsigned int {
+    return _id;
+}
+
+auto AbstractType::getTraits() const noexcept -> const TypeTraits & {
+    return _traits;
+}
+
 auto AbstractType::setLLVMType(llvm::Type *type) -> void {
     _llvm_type = type;
 }
@@ -128,11 +144,18 @@ auto AliasType::toDisplay() const noexcept -> std::string {
     return getDisplayName() + " aka " + getName();
 }
 
+auto AliasType::getAliasedType() const noexcept -> std::shared_ptr<AbstractType> {
+    return _aliased_type;
+}
+
 auto AliasType::generateLLVMType(llvm::LLVMContext *context) -> void {
     throw std::logic_error("Should not be called for scalar alias types");
 }
 
 auto operator==(const std::shared_ptr<AbstractType> &a, const std::shared_ptr<AbstractType> &b) -> bool {
+    if (a->getId() != 0 && b->getId() != 0) {
+        return a->getId() == b->getId();
+    }
     return a->getName() == b->getName();
 }
 
@@ -23,12 +23,14 @@
  */
 #include "filc/grammar/array/Array.h"
 
+#include <utility>
+
 using namespace filc;
 
-Array::Array(const std::vector<std::shared_ptr<Expression>> &values)
-    : _size(values.size()), _full_size(0), _values(values) {}
+Array::Array(std::vector<Expression *> values)
+    : Expression(ExpressionKind::ARRAY), _size(values.size()), _full_size(0), _values(std::move(values)) {}
 
-auto Array::getValues() const -> const std::vector<std::shared_ptr<Expression>> & {
+auto Array::getValues() const -> const std::vector<Expression *> & {
     return _values;
 }
 
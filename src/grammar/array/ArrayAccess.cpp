@@ -25,10 +25,10 @@
 
 using namespace filc;
 
-ArrayAccess::ArrayAccess(std::shared_ptr<Expression> array, const unsigned int index)
-    : _array(std::move(array)), _index(index) {}
+ArrayAccess::ArrayAccess(Expression *array, const unsigned int index)
+    : Expression(ExpressionKind::ARRAY_ACCESS), _array(array), _index(index) {}
 
-auto ArrayAccess::getArray() const -> std::shared_ptr<Expression> {
+auto ArrayAccess::getArray() const -> Expression *{
     return _array;
 }
 
@@ -27,14 +27,14 @@
 
 using namespace filc;
 
-Assignation::Assignation(std::string identifier, std::shared_ptr<Expression> value)
-    : _identifier(std::move(identifier)), _value(std::move(value)) {}
+Assignation::Assignation(std::string identifier, Expression *value)
+    : Expression(ExpressionKind::ASSIGNATION), _identifier(std::move(identifier)), _value(value) {}
 
 auto Assignation::getIdentifier() const -> std::string {
     return _identifier;
 }
 
-auto Assignation::getValue() const -> std::shared_ptr<Expression> {
+auto Assignation::getValue() const -> Expression *{
     return _value;
 }
 
@@ -23,28 +23,35 @@
  */
 #include "filc/grammar/calcul/Calcul.h"
 
-#include <utility>
-
 using namespace filc;
 
-BinaryCalcul::BinaryCalcul(
-    std::shared_ptr<Expression> left_expression, std::string op, std::shared_ptr<Expression> right_expression
-)
-    : _left_expression(std::move(left_expression)), _operator(std::move(op)),
-      _right_expression(std::move(right_expression)) {}
+BinaryCalcul::BinaryCalcul(Expression *left_expression, const BinaryOperator op, Expression *right_expression)
+    : Expression(ExpressionKind::BINARY_CALCUL), _left_expression(left_expression), _operator(op),
+      _right_expression(right_expression) {}
 
-auto BinaryCalcul::getLeftExpression() const -> std::shared_ptr<Expression> {
+auto BinaryCalcul::getLeftExpression() const -> Expression *{
     return _left_expression;
 }
 
-auto BinaryCalcul::getOperator() const -> std::string {
+auto BinaryCalcul::getOperator() const -> BinaryOperator {
     return _operator;
 }
 
-auto BinaryCalcul::getRightExpression() const -> std::shared_ptr<Expression> {
+auto BinaryCalcul::getRightExpression() const -> Expression *{
     return _right_expression;
 }
 
+auto BinaryCalcul::getLeftChain() const -> std::vector<BinaryCalcul *> {
+    std::vector<BinaryCalcul *> chain;
+    auto left = _left_expression;
+    while (left->getKind() == ExpressionKind::BINARY_CALCUL) {
+        chain.push_back(static_cast<BinaryCalcul *>(left));
+        left = chain.back()->getLeftExpression();
+    }
+
+    return chain;
+}
+
 auto BinaryCalcul::acceptVoidVisitor(Visitor<void> *visitor) -> void {
     visitor->visitBinaryCalcul(this);
 }
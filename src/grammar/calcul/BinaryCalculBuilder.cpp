@@ -0,0 +1,77 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2025-Present Kevin Traini
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "filc/grammar/calcul/BinaryCalculBuilder.h"
+
+#include "filc/grammar/calcul/Calcul.h"
+#include <stdexcept>
+
+using namespace filc;
+
+BinaryCalculBuilder::BinaryCalculBuilder(Arena *arena): _arena(arena) {}
+
+auto BinaryCalculBuilder::pushOperand(
+    Expression *operand, const antlr4::Token *start_token, const antlr4::Token *end_token
+) -> void {
+    if (_operands.size() != _operators.size()) {
+        throw std::logic_error("An operator is expected between two operands");
+    }
+    _operands.push_back({operand, start_token, end_token});
+}
+
+auto BinaryCalculBuilder::pushOperator(const BinaryOperator op) -> void {
+    if (_operands.size() != _operators.size() + 1) {
+        throw std::logic_error("An operand is expected before an operator");
+    }
+
+    // Left associativity: everything already stacked binding at least as strongly is grouped first
+    while (! _operators.empty() && getPrecedence(_operators.back()) >= getPrecedence(op)) {
+        reduce();
+    }
+    _operators.push_back(op);
+}
+
+auto BinaryCalculBuilder::build() -> Expression * {
+    if (_operands.size() != _operators.size() + 1) {
+        throw std::logic_error("An operand is expected after an operator");
+    }
+
+    while (! _operators.empty()) {
+        reduce();
+    }
+
+    return _operands.back().expression;
+}
+
+auto BinaryCalculBuilder::reduce() -> void {
+    const auto right = _operands.back();
+    _operands.pop_back();
+    auto &left = _operands.back();
+
+    const auto calcul = _arena->make<BinaryCalcul>(left.expression, _operators.back(), right.expression);
+    calcul->setPosition(Position(left.start_token, right.end_token));
+    _operators.pop_back();
+
+    left.expression = calcul;
+    left.end_token  = right.end_token;
+}
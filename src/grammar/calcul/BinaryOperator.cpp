@@ -0,0 +1,82 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2025-Present Kevin Traini
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "filc/grammar/calcul/BinaryOperator.h"
+
+#include <stdexcept>
+
+auto filc::toString(const BinaryOperator op) -> std::string {
+    switch (op) {
+        case BinaryOperator::MOD:
+            return "%";
+        case BinaryOperator::PLUS:
+            return "+";
+        case BinaryOperator::MINUS:
+            return "-";
+        case BinaryOperator::DIV:
+            return "/";
+        case BinaryOperator::STAR:
+            return "*";
+        case BinaryOperator::LT:
+            return "<";
+        case BinaryOperator::LTE:
+            return "<=";
+        case BinaryOperator::GT:
+            return ">";
+        case BinaryOperator::GTE:
+            return ">=";
+        case BinaryOperator::EQEQ:
+            return "==";
+        case BinaryOperator::NEQ:
+            return "!=";
+        case BinaryOperator::AND:
+            return "&&";
+        case BinaryOperator::OR:
+            return "||";
+    }
+    throw std::logic_error("Unknown binary operator");
+}
+
+auto filc::getPrecedence(const BinaryOperator op) -> unsigned int {
+    switch (op) {
+        case BinaryOperator::MOD:
+            return 5;
+        case BinaryOperator::DIV:
+        case BinaryOperator::STAR:
+            return 4;
+        case BinaryOperator::PLUS:
+        case BinaryOperator::MINUS:
+            return 3;
+        case BinaryOperator::LT:
+        case BinaryOperator::LTE:
+        case BinaryOperator::GT:
+        case BinaryOperator::GTE:
+        case BinaryOperator::EQEQ:
+        case BinaryOperator::NEQ:
+            return 2;
+        case BinaryOperator::AND:
+        case BinaryOperator::OR:
+            return 1;
+    }
+    throw std::logic_error("Unknown binary operator");
+}
@@ -25,7 +25,11 @@
 
 using namespace filc;
 
-Expression::Expression() = default;
+Expression::Expression(const ExpressionKind kind): _kind(kind) {}
+
+auto Expression::getKind() const -> ExpressionKind {
+    return _kind;
+}
 
 auto Expression::setPosition(const Position &position) -> void {
     _position = position;
@@ -27,7 +27,7 @@
 
 using namespace filc;
 
-Identifier::Identifier(std::string name): _name(std::move(name)) {}
+Identifier::Identifier(std::string name): Expression(ExpressionKind::IDENTIFIER), _name(std::move(name)) {}
 
 auto Identifier::getName() const -> std::string {
     return _name;
@@ -25,7 +25,7 @@
 
 using namespace filc;
 
-BooleanLiteral::BooleanLiteral(const bool value): Literal(value) {}
+BooleanLiteral::BooleanLiteral(const bool value): Literal(ExpressionKind::BOOLEAN_LITERAL, value) {}
 
 auto BooleanLiteral::acceptVoidVisitor(Visitor<void> *visitor) -> void {
     visitor->visitBooleanLiteral(this);
@@ -28,7 +28,7 @@
 
 using namespace filc;
 
-CharacterLiteral::CharacterLiteral(const char value): Literal(value) {}
+CharacterLiteral::CharacterLiteral(const char value): Literal(ExpressionKind::CHARACTER_LITERAL, value) {}
 
 auto CharacterLiteral::stringToChar(const std::string &snippet) -> char {
     const auto value = snippet.substr(1, snippet.length() - 2);
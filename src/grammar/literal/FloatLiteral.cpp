@@ -25,7 +25,7 @@
 
 using namespace filc;
 
-FloatLiteral::FloatLiteral(const double value): Literal(value) {}
+FloatLiteral::FloatLiteral(const double value): Literal(ExpressionKind::FLOAT_LITERAL, value) {}
 
 auto FloatLiteral::acceptVoidVisitor(Visitor<void> *visitor) -> void {
     visitor->visitFloatLiteral(this);
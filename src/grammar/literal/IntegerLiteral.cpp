@@ -25,7 +25,7 @@
 
 using namespace filc;
 
-IntegerLiteral::IntegerLiteral(const int value): Literal(value) {}
+IntegerLiteral::IntegerLiteral(const int value): Literal(ExpressionKind::INTEGER_LITERAL, value) {}
 
 auto IntegerLiteral::acceptVoidVisitor(Visitor<void> *visitor) -> void {
     visitor->visitIntegerLiteral(this);
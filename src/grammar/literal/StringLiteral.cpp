@@ -25,7 +25,8 @@
 
 using namespace filc;
 
-StringLiteral::StringLiteral(const std::string &value): Literal(value.substr(1, value.length() - 2)) {}
+StringLiteral::StringLiteral(const std::string &value)
+    : Literal(ExpressionKind::STRING_LITERAL, value.substr(1, value.length() - 2)) {}
 
 auto StringLiteral::acceptVoidVisitor(Visitor<void> *visitor) -> void {
     visitor->visitStringLiteral(this);
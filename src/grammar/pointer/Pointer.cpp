@@ -25,14 +25,14 @@
 
 using namespace filc;
 
-Pointer::Pointer(std::string type_name, const std::shared_ptr<Expression> &value)
-    : _type_name(std::move(type_name)), _value(value) {}
+Pointer::Pointer(std::string type_name, Expression *value)
+    : Expression(ExpressionKind::POINTER), _type_name(std::move(type_name)), _value(value) {}
 
 auto Pointer::getTypeName() const -> std::string {
     return _type_name;
 }
 
-auto Pointer::getValue() const -> std::shared_ptr<Expression> {
+auto Pointer::getValue() const -> Expression *{
     return _value;
 }
 
@@ -25,9 +25,10 @@
 
 using namespace filc;
 
-PointerDereferencing::PointerDereferencing(const std::shared_ptr<Expression> &pointer): _pointer(pointer) {}
+PointerDereferencing::PointerDereferencing(Expression *pointer)
+    : Expression(ExpressionKind::POINTER_DEREFERENCING), _pointer(pointer) {}
 
-auto PointerDereferencing::getPointer() const -> std::shared_ptr<Expression> {
+auto PointerDereferencing::getPointer() const -> Expression *{
     return _pointer;
 }
 
@@ -25,9 +25,10 @@
 
 using namespace filc;
 
-VariableAddress::VariableAddress(const std::shared_ptr<Expression> &variable): _variable(variable) {}
+VariableAddress::VariableAddress(Expression *variable)
+    : Expression(ExpressionKind::VARIABLE_ADDRESS), _variable(variable) {}
 
-auto VariableAddress::getVariable() const -> std::shared_ptr<Expression> {
+auto VariableAddress::getVariable() const -> Expression *{
     return _variable;
 }
 
@@ -25,9 +25,25 @@
 
 using namespace filc;
 
-Program::Program(const std::vector<std::shared_ptr<Expression>> &expressions): _expressions(expressions) {}
+Program::Program(): _source(nullptr) {}
 
-auto Program::getExpressions() const -> const std::vector<std::shared_ptr<Expression>> & {
+auto Program::getArena() -> Arena & {
+    return _arena;
+}
+
+auto Program::setSource(const SourceBuffer *source) -> void {
+    _source = source;
+}
+
+auto Program::getSource() const -> const SourceBuffer * {
+    return _source;
+}
+
+auto Program::addExpression(Expression *expression) -> void {
+    _expressions.push_back(expression);
+}
+
+auto Program::getExpressions() const -> const std::vector<Expression *> & {
     return _expressions;
 }
 
@@ -28,9 +28,10 @@
 using namespace filc;
 
 VariableDeclaration::VariableDeclaration(
-    const bool is_constant, std::string name, std::string type_name, std::shared_ptr<Expression> value
+    const bool is_constant, std::string name, std::string type_name, Expression *value
 )
-    : _constant(is_constant), _name(std::move(name)), _type_name(std::move(type_name)), _value(std::move(value)) {}
+    : Expression(ExpressionKind::VARIABLE_DECLARATION), _constant(is_constant), _name(std::move(name)),
+      _type_name(std::move(type_name)), _value(value) {}
 
 auto VariableDeclaration::isConstant() const -> bool {
     return _constant;
@@ -44,7 +45,7 @@ auto VariableDeclaration::getTypeName() const -> std::string {
     return _type_name;
 }
 
-auto VariableDeclaration::getValue() const -> std::shared_ptr<Expression> {
+auto VariableDeclaration::getValue() const -> Expression *{
     return _value;
 }
 
@@ -23,358 +23,164 @@
  */
 #include "filc/llvm/CalculBuilder.h"
 
-#include "filc/grammar/calcul/Calcul.h"
+#include "filc/grammar/Dispatch.h"
 
 using namespace filc;
 
+namespace {
+using Creator = llvm::Value *(*) (llvm::IRBuilder<> *builder, llvm::Value *left, llvm::Value *right);
+
+#define CREATOR(method, name)                                                                                          \
+    [](llvm::IRBuilder<> *builder, llvm::Value *left, llvm::Value *right) -> llvm::Value * {                           \
+        return builder->method(left, right, name);                                                                     \
+    }
+
+// Indexed by [TypeClass][BinaryOperator], nullptr when the operation cannot be built from the table.
+// Pointer addition needs the pointed type, so it is built separately.
+constexpr Creator CALCUL_CREATORS[TYPE_CLASS_COUNT][BINARY_OPERATOR_COUNT] = {
+  /* SIGNED_INT */
+  {
+    CREATOR(CreateSRem, "int_mod"),
+    CREATOR(CreateAdd, "int_add"),
+    CREATOR(CreateSub, "int_sub"),
+    CREATOR(CreateSDiv, "int_div"),
+    CREATOR(CreateMul, "int_mul"),
+    CREATOR(CreateICmpSLT, "int_lt"),
+    CREATOR(CreateICmpSLE, "int_le"),
+    CREATOR(CreateICmpSGT, "int_gt"),
+    CREATOR(CreateICmpSGE, "int_ge"),
+    CREATOR(CreateICmpEQ, "int_equality"),
+    CREATOR(CreateICmpNE, "int_inequality"),
+    nullptr,
+    nullptr,
+  },
+  /* UNSIGNED_INT */
+  {
+    CREATOR(CreateURem, "int_mod"),
+    CREATOR(CreateAdd, "int_add"),
+    CREATOR(CreateSub, "int_sub"),
+    CREATOR(CreateUDiv, "int_div"),
+    CREATOR(CreateMul, "int_mul"),
+    CREATOR(CreateICmpULT, "int_lt"),
+    CREATOR(CreateICmpULE, "int_le"),
+    CREATOR(CreateICmpUGT, "int_gt"),
+    CREATOR(CreateICmpUGE, "int_ge"),
+    CREATOR(CreateICmpEQ, "int_equality"),
+    CREATOR(CreateICmpNE, "int_inequality"),
+    nullptr,
+    nullptr,
+  },
+  /* FLOAT */
+  {
+    CREATOR(CreateFRem, "float_mod"),
+    CREATOR(CreateFAdd, "float_add"),
+    CREATOR(CreateFSub, "float_sub"),
+    CREATOR(CreateFDiv, "float_div"),
+    CREATOR(CreateFMul, "float_mul"),
+    CREATOR(CreateFCmpOLT, "float_lt"),
+    CREATOR(CreateFCmpOLE, "float_le"),
+    CREATOR(CreateFCmpOGT, "float_gt"),
+    CREATOR(CreateFCmpOGE, "float_ge"),
+    CREATOR(CreateFCmpOEQ, "float_equality"),
+    CREATOR(CreateFCmpONE, "float_inequality"),
+    nullptr,
+    nullptr,
+  },
+  /* BOOL */
+  {
+    nullptr,
+    nullptr,
+    nullptr,
+    nullptr,
+    nullptr,
+    nullptr,
+    nullptr,
+    nullptr,
+    nullptr,
+    CREATOR(CreateICmpEQ, "bool_equality"),
+    CREATOR(CreateICmpNE, "bool_inequality"),
+    CREATOR(CreateAnd, "bool_and"),
+    CREATOR(CreateOr, "bool_or"),
+  },
+  /* POINTER */
+  {
+    nullptr,
+    nullptr,
+    nullptr,
+    nullptr,
+    nullptr,
+    nullptr,
+    nullptr,
+    nullptr,
+    nullptr,
+    CREATOR(CreateICmpEQ, "pointer_equality"),
+    CREATOR(CreateICmpNE, "pointer_inequality"),
+    nullptr,
+    nullptr,
+  },
+  /* OTHER */
+  {},
+};
+
+#undef CREATOR
+} // namespace
+
 CalculBuilder::CalculBuilder(IRGenerator *generator, llvm::IRBuilder<> *builder)
     : _generator(generator), _builder(builder) {}
 
 auto CalculBuilder::buildCalculValue(const BinaryCalcul *calcul) const -> llvm::Value * {
-    const auto left_type_name = calcul->getLeftExpression()->getType()->getName();
-    const auto operation      = calcul->getOperator();
-
-    const std::vector<std::string> signed_integers = {"i8", "i16", "i32", "i64", "i128"};
-    if (std::find(signed_integers.begin(), signed_integers.end(), left_type_name) != signed_integers.end()) {
-        return buildSignedInteger(calcul);
-    }
-
-    const std::vector<std::string> unsigned_integers = {"u8", "u16", "u32", "u64", "u128"};
-    if (std::find(unsigned_integers.begin(), unsigned_integers.end(), left_type_name) != unsigned_integers.end()) {
-        return buildUnsignedInteger(calcul);
-    }
-
-    if (left_type_name == "f32" || left_type_name == "f64") {
-        return buildFloat(calcul);
-    }
-
-    if (left_type_name == "bool") {
-        return buildBool(calcul);
+    // Left operands are built from the innermost calcul instead of recursing, long chains would overflow the stack.
+    // The walk stops at the first calcul folded by validation.
+    std::vector<const BinaryCalcul *> chain = {calcul};
+    llvm::Value *value                      = nullptr;
+    while (value == nullptr) {
+        const auto left = chain.back()->getLeftExpression();
+        if (left->getKind() != ExpressionKind::BINARY_CALCUL) {
+            value = dispatch(_generator, left);
+        } else if (const auto constant = _generator->getFoldedConstant(left); constant != nullptr) {
+            value = constant;
+        } else {
+            chain.push_back(static_cast<const BinaryCalcul *>(left));
+        }
     }
 
-    if (left_type_name[left_type_name.length() - 1] == '*') {
-        return buildPointer(calcul);
+    for (auto it = chain.rbegin(); it != chain.rend(); it++) {
+        value = buildOperation(*it, value);
     }
-
-    throw buildError(calcul);
+    return value;
 }
 
-auto CalculBuilder::buildSignedInteger(const BinaryCalcul *calcul) const -> llvm::Value * {
-    const auto operation = calcul->getOperator();
-    if (operation == "%") {
-        return _builder->CreateSRem(
-            calcul->getLeftExpression()->acceptIRVisitor(_generator),
-            calcul->getRightExpression()->acceptIRVisitor(_generator),
-            "int_mod"
-        );
-    }
-    if (operation == "+") {
-        return _builder->CreateAdd(
-            calcul->getLeftExpression()->acceptIRVisitor(_generator),
-            calcul->getRightExpression()->acceptIRVisitor(_generator),
-            "int_add"
-        );
-    }
-    if (operation == "-") {
-        return _builder->CreateSub(
-            calcul->getLeftExpression()->acceptIRVisitor(_generator),
-            calcul->getRightExpression()->acceptIRVisitor(_generator),
-            "int_sub"
-        );
-    }
-    if (operation == "/") {
-        return _builder->CreateSDiv(
-            calcul->getLeftExpression()->acceptIRVisitor(_generator),
-            calcul->getRightExpression()->acceptIRVisitor(_generator),
-            "int_div"
-        );
-    }
-    if (operation == "*") {
-        return _builder->CreateMul(
-            calcul->getLeftExpression()->acceptIRVisitor(_generator),
-            calcul->getRightExpression()->acceptIRVisitor(_generator),
-            "int_mul"
-        );
-    }
-    if (operation == "<") {
-        return _builder->CreateICmpSLT(
-            calcul->getLeftExpression()->acceptIRVisitor(_generator),
-            calcul->getRightExpression()->acceptIRVisitor(_generator),
-            "int_lt"
-        );
-    }
-    if (operation == "<=") {
-        return _builder->CreateICmpSLE(
-            calcul->getLeftExpression()->acceptIRVisitor(_generator),
-            calcul->getRightExpression()->acceptIRVisitor(_generator),
-            "int_le"
-        );
-    }
-    if (operation == ">") {
-        return _builder->CreateICmpSGT(
-            calcul->getLeftExpression()->acceptIRVisitor(_generator),
-            calcul->getRightExpression()->acceptIRVisitor(_generator),
-            "int_gt"
-        );
-    }
-    if (operation == ">=") {
-        return _builder->CreateICmpSGE(
-            calcul->getLeftExpression()->acceptIRVisitor(_generator),
-            calcul->getRightExpression()->acceptIRVisitor(_generator),
-            "int_ge"
-        );
-    }
-    if (operation == "==") {
-        return _builder->CreateICmpEQ(
-            calcul->getLeftExpression()->acceptIRVisitor(_generator),
-            calcul->getRightExpression()->acceptIRVisitor(_generator),
-            "int_equality"
-        );
-    }
-    if (operation == "!=") {
-        return _builder->CreateICmpNE(
-            calcul->getLeftExpression()->acceptIRVisitor(_generator),
-            calcul->getRightExpression()->acceptIRVisitor(_generator),
-            "int_inequality"
-        );
-    }
-    throw buildError(calcul);
-}
+auto CalculBuilder::buildOperation(const BinaryCalcul *calcul, llvm::Value *left) const -> llvm::Value * {
+    const auto &left_traits = calcul->getLeftExpression()->getType()->getTraits();
+    const auto operation    = calcul->getOperator();
 
-auto CalculBuilder::buildUnsignedInteger(const BinaryCalcul *calcul) const -> llvm::Value * {
-    const auto operation = calcul->getOperator();
-    if (operation == "%") {
-        return _builder->CreateURem(
-            calcul->getLeftExpression()->acceptIRVisitor(_generator),
-            calcul->getRightExpression()->acceptIRVisitor(_generator),
-            "int_mod"
-        );
-    }
-    if (operation == "+") {
-        return _builder->CreateAdd(
-            calcul->getLeftExpression()->acceptIRVisitor(_generator),
-            calcul->getRightExpression()->acceptIRVisitor(_generator),
-            "int_add"
-        );
-    }
-    if (operation == "-") {
-        return _builder->CreateSub(
-            calcul->getLeftExpression()->acceptIRVisitor(_generator),
-            calcul->getRightExpression()->acceptIRVisitor(_generator),
-            "int_sub"
-        );
-    }
-    if (operation == "/") {
-        return _builder->CreateUDiv(
-            calcul->getLeftExpression()->acceptIRVisitor(_generator),
-            calcul->getRightExpression()->acceptIRVisitor(_generator),
-            "int_div"
-        );
-    }
-    if (operation == "*") {
-        return _builder->CreateMul(
-            calcul->getLeftExpression()->acceptIRVisitor(_generator),
-            calcul->getRightExpression()->acceptIRVisitor(_generator),
-            "int_mul"
-        );
+    if (left_traits.is_pointer && operation == BinaryOperator::PLUS) {
+        return buildPointerAdd(calcul, left);
     }
-    if (operation == "<") {
-        return _builder->CreateICmpULT(
-            calcul->getLeftExpression()->acceptIRVisitor(_generator),
-            calcul->getRightExpression()->acceptIRVisitor(_generator),
-            "int_lt"
-        );
-    }
-    if (operation == "<=") {
-        return _builder->CreateICmpULE(
-            calcul->getLeftExpression()->acceptIRVisitor(_generator),
-            calcul->getRightExpression()->acceptIRVisitor(_generator),
-            "int_le"
-        );
-    }
-    if (operation == ">") {
-        return _builder->CreateICmpUGT(
-            calcul->getLeftExpression()->acceptIRVisitor(_generator),
-            calcul->getRightExpression()->acceptIRVisitor(_generator),
-            "int_gt"
-        );
-    }
-    if (operation == ">=") {
-        return _builder->CreateICmpUGE(
-            calcul->getLeftExpression()->acceptIRVisitor(_generator),
-            calcul->getRightExpression()->acceptIRVisitor(_generator),
-            "int_ge"
-        );
-    }
-    if (operation == "==") {
-        return _builder->CreateICmpEQ(
-            calcul->getLeftExpression()->acceptIRVisitor(_generator),
-            calcul->getRightExpression()->acceptIRVisitor(_generator),
-            "int_equality"
-        );
-    }
-    if (operation == "!=") {
-        return _builder->CreateICmpNE(
-            calcul->getLeftExpression()->acceptIRVisitor(_generator),
-            calcul->getRightExpression()->acceptIRVisitor(_generator),
-            "int_inequality"
-        );
-    }
-    throw buildError(calcul);
-}
 
-auto CalculBuilder::buildFloat(const BinaryCalcul *calcul) const -> llvm::Value * {
-    const auto operation = calcul->getOperator();
-    if (operation == "%") {
-        return _builder->CreateFRem(
-            calcul->getLeftExpression()->acceptIRVisitor(_generator),
-            calcul->getRightExpression()->acceptIRVisitor(_generator),
-            "float_mod"
-        );
-    }
-    if (operation == "+") {
-        return _builder->CreateFAdd(
-            calcul->getLeftExpression()->acceptIRVisitor(_generator),
-            calcul->getRightExpression()->acceptIRVisitor(_generator),
-            "float_add"
-        );
-    }
-    if (operation == "-") {
-        return _builder->CreateFSub(
-            calcul->getLeftExpression()->acceptIRVisitor(_generator),
-            calcul->getRightExpression()->acceptIRVisitor(_generator),
-            "float_sub"
-        );
-    }
-    if (operation == "/") {
-        return _builder->CreateFDiv(
-            calcul->getLeftExpression()->acceptIRVisitor(_generator),
-            calcul->getRightExpression()->acceptIRVisitor(_generator),
-            "float_div"
-        );
-    }
-    if (operation == "*") {
-        return _builder->CreateFMul(
-            calcul->getLeftExpression()->acceptIRVisitor(_generator),
-            calcul->getRightExpression()->acceptIRVisitor(_generator),
-            "float_mul"
-        );
-    }
-    if (operation == "<") {
-        return _builder->CreateFCmpOLT(
-            calcul->getLeftExpression()->acceptIRVisitor(_generator),
-            calcul->getRightExpression()->acceptIRVisitor(_generator),
-            "float_lt"
-        );
-    }
-    if (operation == "<=") {
-        return _builder->CreateFCmpOLE(
-            calcul->getLeftExpression()->acceptIRVisitor(_generator),
-            calcul->getRightExpression()->acceptIRVisitor(_generator),
-            "float_le"
-        );
+    const auto creator
+        = CALCUL_CREATORS[static_cast<std::size_t>(left_traits.type_class)][static_cast<std::size_t>(operation)];
+    if (creator == nullptr) {
+        throw buildError(calcul);
     }
-    if (operation == ">") {
-        return _builder->CreateFCmpOGT(
-            calcul->getLeftExpression()->acceptIRVisitor(_generator),
-            calcul->getRightExpression()->acceptIRVisitor(_generator),
-            "float_gt"
-        );
-    }
-    if (operation == ">=") {
-        return _builder->CreateFCmpOGE(
-            calcul->getLeftExpression()->acceptIRVisitor(_generator),
-            calcul->getRightExpression()->acceptIRVisitor(_generator),
-            "float_ge"
-        );
-    }
-    if (operation == "==") {
-        return _builder->CreateFCmpOEQ(
-            calcul->getLeftExpression()->acceptIRVisitor(_generator),
-            calcul->getRightExpression()->acceptIRVisitor(_generator),
-            "float_equality"
-        );
-    }
-    if (operation == "!=") {
-        return _builder->CreateFCmpONE(
-            calcul->getLeftExpression()->acceptIRVisitor(_generator),
-            calcul->getRightExpression()->acceptIRVisitor(_generator),
-            "float_inequality"
-        );
-    }
-    throw buildError(calcul);
-}
 
-auto CalculBuilder::buildBool(const BinaryCalcul *calcul) const -> llvm::Value * {
-    const auto operation = calcul->getOperator();
-    if (operation == "&&") {
-        return _builder->CreateAnd(
-            calcul->getLeftExpression()->acceptIRVisitor(_generator),
-            calcul->getRightExpression()->acceptIRVisitor(_generator),
-            "bool_and"
-        );
-    }
-    if (operation == "||") {
-        return _builder->CreateOr(
-            calcul->getLeftExpression()->acceptIRVisitor(_generator),
-            calcul->getRightExpression()->acceptIRVisitor(_generator),
-            "bool_or"
-        );
-    }
-    if (operation == "==") {
-        return _builder->CreateICmpEQ(
-            calcul->getLeftExpression()->acceptIRVisitor(_generator),
-            calcul->getRightExpression()->acceptIRVisitor(_generator),
-            "bool_equality"
-        );
-    }
-    if (operation == "!=") {
-        return _builder->CreateICmpNE(
-            calcul->getLeftExpression()->acceptIRVisitor(_generator),
-            calcul->getRightExpression()->acceptIRVisitor(_generator),
-            "bool_inequality"
-        );
-    }
-    throw buildError(calcul);
+    const auto right = dispatch(_generator, calcul->getRightExpression());
+    return creator(_builder, left, right);
 }
 
-auto CalculBuilder::buildPointer(const BinaryCalcul *calcul) const -> llvm::Value * {
-    const auto operation = calcul->getOperator();
-    if (operation == "==") {
-        return _builder->CreateICmpEQ(
-            calcul->getLeftExpression()->acceptIRVisitor(_generator),
-            calcul->getRightExpression()->acceptIRVisitor(_generator),
-            "pointer_equality"
-        );
+auto CalculBuilder::buildPointerAdd(const BinaryCalcul *calcul, llvm::Value *left) const -> llvm::Value * {
+    const auto pointed_type = calcul->getLeftExpression()->getType()->getTraits().element_type;
+    if (pointed_type == nullptr) {
+        throw std::logic_error("Left operand of 'pointer +' is not a pointer");
     }
-    if (operation == "!=") {
-        return _builder->CreateICmpNE(
-            calcul->getLeftExpression()->acceptIRVisitor(_generator),
-            calcul->getRightExpression()->acceptIRVisitor(_generator),
-            "pointer_inequality"
-        );
-    }
-    if (operation == "+") {
-        const auto left_type         = calcul->getLeftExpression()->getType();
-        const auto left_pointer_type = std::dynamic_pointer_cast<PointerType>(left_type);
-        if (left_pointer_type == nullptr) {
-            throw std::logic_error("Left operand of 'pointer +' is not a pointer");
-        }
 
-        const auto add = _builder->CreateGEP(
-            left_pointer_type->getPointedType()->getLLVMType(_generator->_llvm_context.get()),
-            calcul->getLeftExpression()->acceptIRVisitor(_generator),
-            calcul->getRightExpression()->acceptIRVisitor(_generator),
-            "pointer_add"
-        );
-        return add;
-    }
-    throw buildError(calcul);
+    const auto right = dispatch(_generator, calcul->getRightExpression());
+    return _builder->CreateGEP(pointed_type->getLLVMType(_generator->_llvm_context.get()), left, right, "pointer_add");
 }
 
 auto CalculBuilder::buildError(const BinaryCalcul *calcul) -> std::logic_error {
     return std::logic_error(
-        "Should be caught by validation, got operation (" + calcul->getOperator() + ") with:\n" + " - "
+        "Should be caught by validation, got operation (" + toString(calcul->getOperator()) + ") with:\n" + " - "
         + calcul->getLeftExpression()->getType()->toDisplay() + "\n" + " - "
         + calcul->getRightExpression()->getType()->toDisplay()
     );
@@ -23,6 +23,7 @@
  */
 #include "filc/llvm/IRGenerator.h"
 
+#include "filc/grammar/Dispatch.h"
 #include "filc/grammar/assignation/Assignation.h"
 #include "filc/grammar/calcul/Calcul.h"
 #include "filc/grammar/identifier/Identifier.h"
@@ -33,22 +34,62 @@
 #include "filc/llvm/CalculBuilder.h"
 
 #include <filc/grammar/array/Array.h>
+#include <llvm/Bitcode/BitcodeWriter.h>
+#include <llvm/ExecutionEngine/Orc/ExecutionUtils.h>
+#include <llvm/ExecutionEngine/Orc/LLJIT.h>
 #include <llvm/IR/LegacyPassManager.h>
 #include <llvm/IR/Verifier.h>
 #include <llvm/MC/MCTargetOptions.h>
 #include <llvm/MC/TargetRegistry.h>
+#include <llvm/Passes/PassBuilder.h>
+#include <llvm/Passes/StandardInstrumentations.h>
+#include <llvm/Support/FileSystem.h>
+#include <llvm/Support/FileUtilities.h>
+#include <llvm/Support/Program.h>
 #include <llvm/Support/TargetSelect.h>
-#include <llvm/Target/TargetMachine.h>
 #include <llvm/Target/TargetOptions.h>
 #include <llvm/TargetParser/Host.h>
+#include <llvm/TargetParser/SubtargetFeature.h>
+#include <llvm/TargetParser/Triple.h>
+#include <algorithm>
+#include <iterator>
+#include <map>
+#include <mutex>
+#include <vector>
 
 using namespace filc;
 
-IRGenerator::IRGenerator(const std::string &filename, const Environment *environment) {
-    _visitor_context = std::make_unique<VisitorContext>();
-    _llvm_context    = std::make_unique<llvm::LLVMContext>();
-    _module          = std::make_unique<llvm::Module>(llvm::StringRef(filename), *_llvm_context);
-    _builder         = std::make_unique<llvm::IRBuilder<>>(*_llvm_context);
+namespace {
+struct Backend {
+    void (*initialize_info)();
+    void (*initialize)();
+    void (*initialize_mc)();
+    void (*initialize_asm_printer)();
+};
+
+// Targets.def is generated by CMake from the FILC_TARGETS option
+#define FILC_TARGET(name)                                                                                              \
+    {LLVMInitialize##name##TargetInfo,                                                                                 \
+     LLVMInitialize##name##Target,                                                                                     \
+     LLVMInitialize##name##TargetMC,                                                                                   \
+     LLVMInitialize##name##AsmPrinter},
+const Backend BACKENDS[] = {
+#include "filc/llvm/Targets.def"
+};
+#undef FILC_TARGET
+
+// Vendor and environment are spelled differently across distributions, they don't change the machine
+auto isHostTriple(const llvm::Triple &triple) -> bool {
+    const llvm::Triple host_triple(llvm::sys::getProcessTriple());
+    return triple.getArch() == host_triple.getArch() && triple.getOS() == host_triple.getOS();
+}
+} // namespace
+
+IRGenerator::IRGenerator(const std::string &filename, const Environment *environment, std::ostream &err)
+    : _environment(environment), _err(err), _optimization_level(llvm::OptimizationLevel::O0) {
+    _llvm_context = std::make_unique<llvm::LLVMContext>();
+    _module       = std::make_unique<llvm::Module>(llvm::StringRef(filename), *_llvm_context);
+    _builder      = std::make_unique<llvm::IRBuilder<>>(*_llvm_context);
     environment->prepareLLVMTypes(_llvm_context.get());
 }
 
@@ -60,39 +101,236 @@ auto IRGenerator::dump() const -> std::string {
     return ir_result;
 }
 
-auto IRGenerator::toTarget(const std::string &output_file, const std::string &target_triple) const -> int {
-    const auto used_target_triple = target_triple.empty() ? llvm::sys::getDefaultTargetTriple() : target_triple;
+auto IRGenerator::getStringPoolStats() const -> const StringPoolStats & {
+    return _string_pool_stats;
+}
+
+auto IRGenerator::initializeTarget(const std::string &target_triple, std::string &error) -> const llvm::Target * {
+    // Target registry is global, several generators can be set up concurrently
+    static std::mutex mutex;
+    static std::size_t registered_infos = 0;
+    static std::map<const llvm::Target *, std::size_t> owners;
+    static std::vector<bool> initialized(std::size(BACKENDS), false);
+    const std::lock_guard<std::mutex> lock(mutex);
+
+    // Target infos are only names and triple matchers, they are registered one backend at a time until one matches
+    auto target = llvm::TargetRegistry::lookupTarget(target_triple, error);
+    while (target == nullptr && registered_infos < std::size(BACKENDS)) {
+        BACKENDS[registered_infos].initialize_info();
+        for (const auto &registered : llvm::TargetRegistry::targets()) {
+            owners.emplace(&registered, registered_infos);
+        }
+        registered_infos++;
+        target = llvm::TargetRegistry::lookupTarget(target_triple, error);
+    }
+    if (target == nullptr) {
+        return nullptr;
+    }
+    error.clear();
+
+    // Code generation tables are only built for the backend actually used
+    const auto owner = owners.at(target);
+    if (! initialized[owner]) {
+        BACKENDS[owner].initialize();
+        BACKENDS[owner].initialize_mc();
+        BACKENDS[owner].initialize_asm_printer();
+        initialized[owner] = true;
+    }
+
+    return target;
+}
+
+auto IRGenerator::resolveTarget(
+    const std::string &target_triple, const std::string &cpu, const std::string &features, std::string &error
+) -> TargetDescription {
+    TargetDescription description;
+    description.triple = target_triple.empty() ? llvm::sys::getDefaultTargetTriple() : target_triple;
+    description.cpu    = cpu;
+
+    llvm::SubtargetFeatures used_features;
+    if (cpu == "native") {
+        if (! isHostTriple(llvm::Triple(description.triple))) {
+            error = "--mcpu=native can't be used for " + description.triple + ", it only describes the host "
+                  + llvm::sys::getProcessTriple();
+            return {};
+        }
+        description.cpu = llvm::sys::getHostCPUName().str();
+        llvm::StringMap<bool> host_features;
+        if (llvm::sys::getHostCPUFeatures(host_features)) {
+            // Sorted so that the same host always gives the same description
+            std::vector<std::pair<std::string, bool>> sorted_features;
+            for (const auto &feature : host_features) {
+                sorted_features.emplace_back(feature.getKey().str(), feature.getValue());
+            }
+            std::sort(sorted_features.begin(), sorted_features.end());
+            for (const auto &[name, enabled] : sorted_features) {
+                used_features.AddFeature(name, enabled);
+            }
+        }
+    }
+    // Explicit features come last so that they override the host ones
+    for (const auto &feature : llvm::SubtargetFeatures(features).getFeatures()) {
+        used_features.AddFeature(feature);
+    }
+    description.features = used_features.getString();
 
-    llvm::InitializeAllTargetInfos();
-    llvm::InitializeAllTargets();
-    llvm::InitializeAllTargetMCs();
-    // FIXME: llvm::InitializeAllAsmParsers();
-    llvm::InitializeAllAsmPrinters();
+    return description;
+}
 
+auto IRGenerator::setupTarget(
+    const std::string &target_triple,
+    const std::string &cpu,
+    const std::string &features,
+    const std::string &optimization_level
+) -> int {
     std::string error;
-    const auto target = llvm::TargetRegistry::lookupTarget(used_target_triple, error);
+    const auto [used_target_triple, used_cpu, used_features_string] =
+        resolveTarget(target_triple, cpu, features, error);
+    if (! error.empty()) {
+        _err << error;
+        return 1;
+    }
+
+    const auto target = initializeTarget(used_target_triple, error);
     if (! target) {
-        std::cerr << error;
+        _err << error;
         return 1;
     }
+
+    auto codegen_level = llvm::CodeGenOptLevel::None;
+    if (optimization_level == "1") {
+        _optimization_level = llvm::OptimizationLevel::O1;
+        codegen_level       = llvm::CodeGenOptLevel::Less;
+    } else if (optimization_level == "2") {
+        _optimization_level = llvm::OptimizationLevel::O2;
+        codegen_level       = llvm::CodeGenOptLevel::Default;
+    } else if (optimization_level == "3") {
+        _optimization_level = llvm::OptimizationLevel::O3;
+        codegen_level       = llvm::CodeGenOptLevel::Aggressive;
+    } else if (optimization_level == "s") {
+        _optimization_level = llvm::OptimizationLevel::Os;
+        codegen_level       = llvm::CodeGenOptLevel::Default;
+    } else {
+        _optimization_level = llvm::OptimizationLevel::O0;
+    }
+
     const llvm::TargetOptions options;
-    const auto target_machine = target->createTargetMachine(
-        used_target_triple, "", "", options, llvm::Reloc::PIC_, std::nullopt, llvm::CodeGenOptLevel::None
-    );
+    _target_machine.reset(target->createTargetMachine(
+        used_target_triple, used_cpu, used_features_string, options, llvm::Reloc::PIC_, std::nullopt, codegen_level
+    ));
 
-    _module->setDataLayout(target_machine->createDataLayout());
+    _module->setDataLayout(_target_machine->createDataLayout());
     _module->setTargetTriple(used_target_triple);
 
+    // Function attributes are what the middle-end (e.g. vectorizers cost model) looks at
+    for (auto &function : *_module) {
+        if (function.isDeclaration()) {
+            continue;
+        }
+        if (! used_cpu.empty()) {
+            function.addFnAttr("target-cpu", used_cpu);
+        }
+        if (! used_features_string.empty()) {
+            function.addFnAttr("target-features", used_features_string);
+        }
+    }
+
+    return 0;
+}
+
+auto IRGenerator::optimize(llvm::raw_ostream *pass_timings) -> void {
+    if (_optimization_level == llvm::OptimizationLevel::O0) {
+        return;
+    }
+
+    llvm::LoopAnalysisManager loop_analysis_manager;
+    llvm::FunctionAnalysisManager function_analysis_manager;
+    llvm::CGSCCAnalysisManager cgscc_analysis_manager;
+    llvm::ModuleAnalysisManager module_analysis_manager;
+
+    // Timings are printed when instrumentations are destroyed, at the end of this function
+    llvm::PassInstrumentationCallbacks instrumentation_callbacks;
+    llvm::StandardInstrumentations instrumentations(_module->getContext(), false);
+    if (pass_timings != nullptr) {
+        instrumentations.getTimePasses().setOutStream(*pass_timings);
+    }
+    instrumentations.registerCallbacks(instrumentation_callbacks, &module_analysis_manager);
+
+    llvm::PassBuilder pass_builder(
+        _target_machine.get(), llvm::PipelineTuningOptions(), std::nullopt, &instrumentation_callbacks
+    );
+    pass_builder.registerModuleAnalyses(module_analysis_manager);
+    pass_builder.registerCGSCCAnalyses(cgscc_analysis_manager);
+    pass_builder.registerFunctionAnalyses(function_analysis_manager);
+    pass_builder.registerLoopAnalyses(loop_analysis_manager);
+    pass_builder.crossRegisterProxies(
+        loop_analysis_manager, function_analysis_manager, cgscc_analysis_manager, module_analysis_manager
+    );
+
+    // Default pipeline: mem2reg (SROA), instcombine, GVN, loop passes, ... tuned for the requested level
+    auto pass_manager = pass_builder.buildPerModuleDefaultPipeline(_optimization_level);
+    pass_manager.run(*_module, module_analysis_manager);
+}
+
+auto IRGenerator::toTarget(const std::string &output_file, const std::string &emit) const -> int {
+    if (_target_machine == nullptr) {
+        throw std::logic_error("setupTarget() should be called before emitting code");
+    }
+
+    if (emit == "exe") {
+        const auto linker = findLinker();
+        if (linker.empty()) {
+            return 1;
+        }
+
+        // The object only lives until the linker has read it
+        int object_fd;
+        llvm::SmallString<128> object_file;
+        if (const auto ec = llvm::sys::fs::createTemporaryFile("filc", "o", object_fd, object_file)) {
+            _err << "Could not create temporary object file: " << ec.message();
+            return 1;
+        }
+        llvm::FileRemover object_remover(object_file);
+
+        llvm::raw_fd_ostream object_out(object_fd, true);
+        const auto status = emitFile(object_out, llvm::CodeGenFileType::ObjectFile);
+        object_out.close();
+        if (status != 0) {
+            return status;
+        }
+
+        return link(linker, object_file.str().str(), output_file);
+    }
+
     std::error_code ec;
-    llvm::raw_fd_stream out(output_file, ec);
+    llvm::raw_fd_ostream out(output_file, ec);
     if (ec) {
-        std::cerr << "Could not open file: " << ec.message();
+        _err << "Could not open file: " << ec.message();
         return 1;
     }
 
+    if (emit == "ll") {
+        _module->print(out, nullptr);
+        return 0;
+    }
+    if (emit == "bc") {
+        llvm::WriteBitcodeToFile(*_module, out);
+        return 0;
+    }
+    if (emit == "asm") {
+        return emitFile(out, llvm::CodeGenFileType::AssemblyFile);
+    }
+    if (emit == "obj") {
+        return emitFile(out, llvm::CodeGenFileType::ObjectFile);
+    }
+
+    throw std::logic_error("Unknown emit kind: " + emit);
+}
+
+auto IRGenerator::emitFile(llvm::raw_pwrite_stream &out, llvm::CodeGenFileType file_type) const -> int {
     auto pass_manager = llvm::legacy::PassManager();
-    if (target_machine->addPassesToEmitFile(pass_manager, out, nullptr, llvm::CodeGenFileType::ObjectFile)) {
-        std::cerr << "Target machine can't emit an object file";
+    if (_target_machine->addPassesToEmitFile(pass_manager, out, nullptr, file_type)) {
+        _err << "Target machine can't emit a file of this type";
         return 1;
     }
 
@@ -102,6 +340,84 @@ auto IRGenerator::toTarget(const std::string &output_file, const std::string &ta
     return 0;
 }
 
+auto IRGenerator::findLinker() const -> std::string {
+    const auto &triple = _target_machine->getTargetTriple();
+    if (isHostTriple(triple)) {
+        auto linker = llvm::sys::findProgramByName("cc");
+        if (! linker) {
+            _err << "Could not find a linker driver (cc) in PATH: " << linker.getError().message();
+            return "";
+        }
+        return *linker;
+    }
+
+    // The host cc would reject an object of another machine, only a cross driver can link it
+    for (const auto &name : {triple.str() + "-cc", triple.str() + "-gcc"}) {
+        if (auto linker = llvm::sys::findProgramByName(name)) {
+            return *linker;
+        }
+    }
+    _err << "Could not find a linker driver for " << triple.str() << " (" << triple.str() << "-cc or " << triple.str()
+         << "-gcc) in PATH, use --emit=obj to get an object file to link yourself";
+    return "";
+}
+
+auto IRGenerator::link(const std::string &linker, const std::string &object_file, const std::string &output_file) const
+    -> int {
+    std::string error;
+    const llvm::StringRef arguments[] = {linker, object_file, "-o", output_file};
+    const auto status                 = llvm::sys::ExecuteAndWait(linker, arguments, std::nullopt, {}, 0, 0, &error);
+    if (status != 0) {
+        _err << "Linking failed" << (error.empty() ? "" : ": " + error);
+        return 1;
+    }
+
+    return 0;
+}
+
+auto IRGenerator::run() -> int {
+    if (_target_machine == nullptr || _module == nullptr) {
+        throw std::logic_error("setupTarget() should be called before running, and only once");
+    }
+
+    auto jit_target_machine_builder = llvm::orc::JITTargetMachineBuilder(_target_machine->getTargetTriple());
+    jit_target_machine_builder.setCPU(_target_machine->getTargetCPU().str());
+    jit_target_machine_builder.addFeatures(
+        llvm::SubtargetFeatures(_target_machine->getTargetFeatureString()).getFeatures()
+    );
+    jit_target_machine_builder.setCodeGenOptLevel(_target_machine->getOptLevel());
+
+    auto jit = llvm::orc::LLJITBuilder().setJITTargetMachineBuilder(std::move(jit_target_machine_builder)).create();
+    if (! jit) {
+        _err << llvm::toString(jit.takeError());
+        return 1;
+    }
+
+    auto process_symbols = llvm::orc::DynamicLibrarySearchGenerator::GetForCurrentProcess(
+        (*jit)->getDataLayout().getGlobalPrefix()
+    );
+    if (! process_symbols) {
+        _err << llvm::toString(process_symbols.takeError());
+        return 1;
+    }
+    (*jit)->getMainJITDylib().addGenerator(std::move(*process_symbols));
+
+    _builder.reset();
+    if (auto error = (*jit)->addIRModule(llvm::orc::ThreadSafeModule(std::move(_module), std::move(_llvm_context)))) {
+        _err << llvm::toString(std::move(error));
+        return 1;
+    }
+
+    auto main_symbol = (*jit)->lookup("main");
+    if (! main_symbol) {
+        _err << llvm::toString(main_symbol.takeError());
+        return 1;
+    }
+
+    const auto main_function = main_symbol->toPtr<int (*)()>();
+    return main_function();
+}
+
 auto IRGenerator::visitProgram(Program *program) -> llvm::Value * {
     const auto function_type = llvm::FunctionType::get(llvm::Type::getInt32Ty(*_llvm_context), {}, false);
     const auto function = llvm::Function::Create(function_type, llvm::Function::ExternalLinkage, "main", _module.get());
@@ -115,14 +431,15 @@ auto IRGenerator::visitProgram(Program *program) -> llvm::Value * {
     } else {
         for (auto it = expressions.begin(); it != expressions.end(); ++it) {
             if (it + 1 != expressions.end()) {
-                (*it)->acceptIRVisitor(this);
+                dispatch(this, *it);
             } else {
-                const auto return_value = (*it)->acceptIRVisitor(this);
+                const auto return_value = dispatch(this, *it);
                 _builder->CreateRet(return_value);
             }
         }
     }
 
+    mergeStringSuffixes();
     llvm::verifyFunction(*function);
 
     return nullptr;
@@ -133,14 +450,14 @@ auto IRGenerator::visitBooleanLiteral(BooleanLiteral *literal) -> llvm::Value *
 }
 
 auto IRGenerator::visitIntegerLiteral(IntegerLiteral *literal) -> llvm::Value * {
-    const auto type_name = literal->getType()->getName();
-    const auto is_signed = type_name[0] == 'i';
-    const auto size      = stoi(type_name.substr(1));
-    return llvm::ConstantInt::get(*_llvm_context, llvm::APInt(size, literal->getValue(), is_signed));
+    const auto &traits = literal->getType()->getTraits();
+    return llvm::ConstantInt::get(
+        *_llvm_context, llvm::APInt(traits.bit_width, literal->getValue(), traits.is_signed_int)
+    );
 }
 
 auto IRGenerator::visitFloatLiteral(FloatLiteral *literal) -> llvm::Value * {
-    if (literal->getType()->getName() == "f32") {
+    if (literal->getType()->getTraits().bit_width == 32) {
         return llvm::ConstantFP::get(*_llvm_context, llvm::APFloat(static_cast<float>(literal->getValue())));
     }
     return llvm::ConstantFP::get(*_llvm_context, llvm::APFloat(literal->getValue()));
@@ -151,12 +468,28 @@ auto IRGenerator::visitCharacterLiteral(CharacterLiteral *literal) -> llvm::Valu
 }
 
 auto IRGenerator::visitStringLiteral(StringLiteral *literal) -> llvm::Value * {
-    return _builder->CreateGlobalString(literal->getValue());
+    _string_pool_stats.literals++;
+    auto value        = literal->getValue();
+    const auto pooled = _string_pool.find(value);
+    if (pooled != _string_pool.end()) {
+        _string_pool_stats.saved_bytes += value.size() + 1;
+        return pooled->second;
+    }
+
+    const auto global = _builder->CreateGlobalString(value);
+    _string_pool.emplace(std::move(value), global);
+    _string_pool_stats.globals++;
+    return global;
 }
 
 auto IRGenerator::visitVariableDeclaration(VariableDeclaration *variable) -> llvm::Value * {
     if (variable->getValue() != nullptr) {
-        const auto value = variable->getValue()->acceptIRVisitor(this);
+        auto value = dispatch(this, variable->getValue());
+        // Constant array literals are read-only data, a mutable variable gets its own copy
+        if (! variable->isConstant() && llvm::isa<llvm::GlobalVariable>(value)
+            && variable->getValue()->getKind() == ExpressionKind::ARRAY) {
+            value = copyConstantArray(llvm::cast<llvm::GlobalVariable>(value));
+        }
         _context.setValue(variable->getName(), value);
         return value;
     }
@@ -174,31 +507,43 @@ auto IRGenerator::visitIdentifier(Identifier *identifier) -> llvm::Value * {
     return value;
 }
 
+auto IRGenerator::getFoldedConstant(const Expression *expression) const -> llvm::Constant * {
+    const auto constant = _environment->getConstant(expression);
+    if (constant == nullptr) {
+        return nullptr;
+    }
+    return constant->toLLVMConstant(_llvm_context.get());
+}
+
 auto IRGenerator::visitBinaryCalcul(BinaryCalcul *calcul) -> llvm::Value * {
+    if (const auto constant = getFoldedConstant(calcul); constant != nullptr) {
+        return constant;
+    }
+
     const CalculBuilder builder(this, _builder.get());
     return builder.buildCalculValue(calcul);
 }
 
 auto IRGenerator::visitAssignation(Assignation *assignation) -> llvm::Value * {
-    const auto value = assignation->getValue()->acceptIRVisitor(this);
+    const auto value = dispatch(this, assignation->getValue());
     _context.setValue(assignation->getIdentifier(), value);
     return value;
 }
 
 auto IRGenerator::visitPointer(Pointer *pointer) -> llvm::Value * {
     const auto alloca = _builder->CreateAlloca(pointer->getPointedType()->getLLVMType(_llvm_context.get()));
-    _builder->CreateStore(pointer->getValue()->acceptIRVisitor(this), alloca);
+    _builder->CreateStore(dispatch(this, pointer->getValue()), alloca);
 
     return alloca;
 }
 
 auto IRGenerator::visitPointerDereferencing(PointerDereferencing *pointer) -> llvm::Value * {
-    const auto pointer_value = pointer->getPointer()->acceptIRVisitor(this);
+    const auto pointer_value = dispatch(this, pointer->getPointer());
     return _builder->CreateLoad(pointer->getType()->getLLVMType(_llvm_context.get()), pointer_value);
 }
 
 auto IRGenerator::visitVariableAddress(VariableAddress *address) -> llvm::Value * {
-    const auto value  = address->getVariable()->acceptIRVisitor(this);
+    const auto value  = dispatch(this, address->getVariable());
     const auto alloca = _builder->CreateAlloca(address->getType()->getLLVMType(_llvm_context.get()));
     _builder->CreateStore(value, alloca);
 
@@ -206,47 +551,191 @@ auto IRGenerator::visitVariableAddress(VariableAddress *address) -> llvm::Value
 }
 
 auto IRGenerator::visitArray(Array *array) -> llvm::Value * {
-    const auto array_type   = array->getType()->getLLVMType(_llvm_context.get());
-    const auto in_array_def = _visitor_context->has("in_array_def");
+    const auto array_def = _visitor_context.top().array_def;
+    if (const auto constant_array = buildConstantArray(array); constant_array != nullptr) {
+        if (array_def == nullptr) {
+            return constant_array;
+        }
+
+        // Inside an array built element by element, the whole sub array is copied at once in its slot
+        _builder->CreateMemCpy(
+            array_def,
+            llvm::MaybeAlign(),
+            constant_array,
+            constant_array->getAlign(),
+            llvm::ConstantExpr::getSizeOf(constant_array->getValueType())
+        );
+        _visitor_context.top().was_in_array_def = true;
+        return nullptr;
+    }
+
+    const auto array_type = array->getType()->getLLVMType(_llvm_context.get());
     const auto alloca
-        = in_array_def
+        = array_def != nullptr
             ? nullptr
             : _builder->CreateAlloca(
                   array_type, llvm::ConstantInt::get(*_llvm_context, llvm::APInt(64, array->getFullSize(), false))
               );
     const auto &array_values = array->getValues();
     for (unsigned int i = 0; i < array_values.size(); ++i) {
-        const auto array_value = in_array_def ? _visitor_context->get<llvm::Value *>("in_array_def") : alloca;
-        _visitor_context->stack();
-
+        const auto array_value  = array_def != nullptr ? array_def : alloca;
         const auto array_access = _builder->CreateConstInBoundsGEP2_64(array_type, array_value, 0, i);
-        _visitor_context->set("in_array_def", array_access);
-        const auto llvm_value = array_values[i]->acceptIRVisitor(this);
+        _visitor_context.stack().array_def = array_access;
+        const auto llvm_value              = dispatch(this, array_values[i]);
 
-        if (! _visitor_context->has("was_in_array_def") || ! _visitor_context->get<bool>("was_in_array_def")) {
+        if (! _visitor_context.top().was_in_array_def) {
             _builder->CreateStore(llvm_value, array_access);
         }
 
-        _visitor_context->unstack();
+        _visitor_context.unstack();
     }
 
-    _visitor_context->set("was_in_array_def", true);
+    _visitor_context.top().was_in_array_def = true;
 
     return alloca;
 }
 
 auto IRGenerator::visitArrayAccess(ArrayAccess *array_access) -> llvm::Value * {
-    _visitor_context->stack();
-    _visitor_context->set("in_array_access", true);
-    const auto value = array_access->getArray()->acceptIRVisitor(this);
-    _visitor_context->unstack();
+    _visitor_context.stack().in_array_access = true;
+    const auto value                         = dispatch(this, array_access->getArray());
+    _visitor_context.unstack();
     const auto gep = _builder->CreateConstInBoundsGEP2_64(
         array_access->getArray()->getType()->getLLVMType(_llvm_context.get()), value, 0, array_access->getIndex()
     );
 
-    if (_visitor_context->has("in_array_access") && _visitor_context->get<bool>("in_array_access")) {
+    if (_visitor_context.top().in_array_access) {
         return gep;
     }
 
     return _builder->CreateLoad(array_access->getType()->getLLVMType(_llvm_context.get()), gep);
 }
+
+auto IRGenerator::buildConstantArray(Array *array) -> llvm::GlobalVariable * {
+    if (! isConstantArray(array)) {
+        return nullptr;
+    }
+    const auto value = buildConstantValue(array);
+    if (value == nullptr) {
+        return nullptr;
+    }
+
+    const auto global = new llvm::GlobalVariable(
+        *_module, value->getType(), true, llvm::GlobalValue::PrivateLinkage, value, "constant_array"
+    );
+    global->setUnnamedAddr(llvm::GlobalValue::UnnamedAddr::Global);
+    return global;
+}
+
+auto IRGenerator::isConstantArray(const Array *array) -> bool {
+    if (const auto found = _constant_arrays.find(array); found != _constant_arrays.end()) {
+        return found->second;
+    }
+
+    auto is_constant = array->getSize() != 0;
+    for (const auto value : array->getValues()) {
+        if (! isConstantValue(value)) {
+            is_constant = false;
+            break;
+        }
+    }
+    _constant_arrays.emplace(array, is_constant);
+    return is_constant;
+}
+
+auto IRGenerator::isConstantValue(const Expression *expression) -> bool {
+    switch (expression->getKind()) {
+        case ExpressionKind::BOOLEAN_LITERAL:
+        case ExpressionKind::INTEGER_LITERAL:
+        case ExpressionKind::FLOAT_LITERAL:
+        case ExpressionKind::CHARACTER_LITERAL:
+            return true;
+        case ExpressionKind::ARRAY:
+            return isConstantArray(static_cast<const Array *>(expression));
+        case ExpressionKind::BINARY_CALCUL:
+        case ExpressionKind::IDENTIFIER:
+            return getFoldedConstant(expression) != nullptr;
+        default:
+            return false;
+    }
+}
+
+auto IRGenerator::buildConstantValue(Expression *expression) -> llvm::Constant * {
+    switch (expression->getKind()) {
+        case ExpressionKind::BOOLEAN_LITERAL:
+        case ExpressionKind::INTEGER_LITERAL:
+        case ExpressionKind::FLOAT_LITERAL:
+        case ExpressionKind::CHARACTER_LITERAL:
+            return llvm::cast<llvm::Constant>(dispatch(this, expression));
+        case ExpressionKind::ARRAY: {
+            const auto array = static_cast<Array *>(expression);
+            if (array->getSize() == 0) {
+                return nullptr;
+            }
+
+            std::vector<llvm::Constant *> values;
+            values.reserve(array->getSize());
+            for (const auto &value : array->getValues()) {
+                const auto constant = buildConstantValue(value);
+                if (constant == nullptr) {
+                    return nullptr;
+                }
+                values.push_back(constant);
+            }
+
+            // Arrays of plain integers and floats are uniqued as a ConstantDataArray
+            const auto array_type = llvm::cast<llvm::ArrayType>(array->getType()->getLLVMType(_llvm_context.get()));
+            return llvm::ConstantArray::get(array_type, values);
+        }
+        case ExpressionKind::BINARY_CALCUL:
+        case ExpressionKind::IDENTIFIER:
+            // Folded by validation, as a in [a, a + 1] after val a = 1
+            return getFoldedConstant(expression);
+        default:
+            return nullptr;
+    }
+}
+
+auto IRGenerator::copyConstantArray(llvm::GlobalVariable *constant_array) -> llvm::Value * {
+    const auto alloca = _builder->CreateAlloca(constant_array->getValueType());
+    _builder->CreateMemCpy(
+        alloca,
+        alloca->getAlign(),
+        constant_array,
+        constant_array->getAlign(),
+        llvm::ConstantExpr::getSizeOf(constant_array->getValueType())
+    );
+    return alloca;
+}
+
+auto IRGenerator::mergeStringSuffixes() -> void {
+    // Sorted by reversed content, a string ends the following one when it is its prefix once reversed.
+    // Walking backward, each string is merged into the longest string of its run.
+    std::vector<std::pair<std::string, llvm::GlobalVariable *>> reversed_strings;
+    reversed_strings.reserve(_string_pool.size());
+    for (const auto &[value, global] : _string_pool) {
+        reversed_strings.emplace_back(std::string(value.rbegin(), value.rend()), global);
+    }
+    std::sort(reversed_strings.begin(), reversed_strings.end());
+
+    const auto index_type = llvm::Type::getInt64Ty(*_llvm_context);
+    for (auto i = reversed_strings.size(); i-- > 1;) {
+        const auto &[value, global]           = reversed_strings[i - 1];
+        const auto &[host_value, host_global] = reversed_strings[i];
+        if (host_value.compare(0, value.size(), value) != 0) {
+            continue;
+        }
+
+        const auto offset        = host_value.size() - value.size();
+        llvm::Constant *indices[] = {llvm::ConstantInt::get(index_type, 0), llvm::ConstantInt::get(index_type, offset)};
+        global->replaceAllUsesWith(
+            llvm::ConstantExpr::getInBoundsGetElementPtr(host_global->getValueType(), host_global, indices)
+        );
+        global->eraseFromParent();
+        _string_pool_stats.globals--;
+        _string_pool_stats.saved_bytes += value.size() + 1;
+
+        // Strings ending this one end its host too, they are merged into it
+        reversed_strings[i - 1] = reversed_strings[i];
+    }
+    _string_pool.clear();
+}
@@ -23,6 +23,12 @@
  */
 #include "filc/options/OptionsParser.h"
 
+#include "filc/server/CompilerServer.h"
+
+#include <algorithm>
+#include <filesystem>
+#include <string>
+#include <system_error>
 #include <utility>
 
 using namespace filc;
@@ -31,13 +37,91 @@ using namespace filc;
 
 OptionsParser::OptionsParser(): _options("filc", "Fil compiler"), _parsed(false) {
     auto main_options = _options.add_options();
-    main_options("file", "Path of file to compile.", cxxopts::value<std::string>()->default_value(""));
+    main_options("file", "Paths of files to compile.", cxxopts::value<std::vector<std::string>>());
     _options.parse_positional("file");
-    _options.positional_help("file");
+    _options.positional_help("file...");
 
     auto general_options = _options.add_options("General");
     general_options("out,o", "Write output to file", cxxopts::value<std::string>()->default_value("a.out"), "<file>");
     general_options("target", "Generate code for the given target", cxxopts::value<std::string>(), "<value>");
+    general_options(
+        "emit",
+        "Kind of output to write. One of these values: exe, obj, asm, bc, ll.",
+        cxxopts::value<std::string>()->default_value("exe"),
+        "<kind>"
+    );
+    general_options(
+        "j,jobs",
+        "Number of files compiled concurrently, 0 to use all cores",
+        cxxopts::value<unsigned int>()->default_value("0"),
+        "<n>"
+    );
+    general_options("run", "Run the program with the JIT instead of writing an object file");
+    general_options(
+        "mcpu", "Generate code for the given CPU, native for the host one", cxxopts::value<std::string>(), "<cpu>"
+    );
+    general_options(
+        "mattr",
+        "Enable (+) or disable (-) target features, comma separated",
+        cxxopts::value<std::string>(),
+        "<+a1,-a2>"
+    );
+    general_options(
+        "O,opt-level",
+        "Optimization level. One of these values: 0, 1, 2, 3, s.",
+        cxxopts::value<std::string>()->default_value("0"),
+        "<level>"
+    );
+
+    auto cache_options = _options.add_options("Cache");
+    cache_options(
+        "cache-dir",
+        "Reuse outputs of previous compilations stored in this directory",
+        cxxopts::value<std::string>(),
+        "<dir>"
+    );
+    cache_options(
+        "cache-size",
+        "Maximum size of the cache, in MiB",
+        cxxopts::value<unsigned long>()->default_value("1024"),
+        "<size>"
+    );
+    cache_options("cache-stats", "Show cache statistics and exit");
+
+    auto server_options = _options.add_options("Server");
+    server_options(
+        "server",
+        "Keep a compiler process listening on the given socket",
+        cxxopts::value<std::string>()->implicit_value(CompilerServer::getDefaultSocketPath()),
+        "<socket>"
+    );
+    server_options(
+        "connect",
+        "Forward this command line to the compiler server listening on the given socket",
+        cxxopts::value<std::string>()->implicit_value(CompilerServer::getDefaultSocketPath()),
+        "<socket>"
+    );
+
+    auto diagnostics_options = _options.add_options("Diagnostics");
+    diagnostics_options(
+        "diagnostics-format",
+        "Format of warnings and errors. One of these values: text, json, sarif.",
+        cxxopts::value<std::string>()->default_value("text"),
+        "<format>"
+    );
+    diagnostics_options("w", "Disable all warnings");
+    diagnostics_options(
+        "W",
+        "Warning option: error to report warnings as errors, no-<code> to disable a warning (e.g. no-unused-value)",
+        cxxopts::value<std::vector<std::string>>(),
+        "<option>"
+    );
+    diagnostics_options(
+        "max-diagnostics",
+        "Stop showing warnings and errors after this many, 0 for no limit",
+        cxxopts::value<unsigned int>()->default_value("0"),
+        "<n>"
+    );
 
     auto trouble_options = _options.add_options("Troubleshooting");
     trouble_options("help", "Show this help message and exit.");
@@ -49,6 +133,8 @@ OptionsParser::OptionsParser(): _options("filc", "Fil compiler"), _parsed(false)
         "Dump some data. One of these values: ast, ir.",
         cxxopts::value<std::string>()->implicit_value("all")->default_value("none")
     );
+    debug_options("time-report", "Show time, CPU time and memory growth of each compilation phase");
+    debug_options("time-trace", "Write a Chrome trace of the compilation phases next to the output (a.out -> a.json)");
 }
 
 auto OptionsParser::parse(const int argc, char **argv) -> void {
@@ -58,6 +144,16 @@ auto OptionsParser::parse(const int argc, char **argv) -> void {
         // Just ignore it, it will be considered as showing help
     }
     _parsed = true;
+
+    // With its implicit value, cxxopts parses the argument following --connect as an input file. It is taken as the
+    // socket instead when it names one.
+    _separate_connect_socket.clear();
+    for (int i = 1; i + 1 < argc; i++) {
+        std::error_code ec;
+        if (std::string(argv[i]) == "--connect" && std::filesystem::is_socket(argv[i + 1], ec)) {
+            _separate_connect_socket = argv[i + 1];
+        }
+    }
 }
 
 auto OptionsParser::isHelp() const -> bool {
@@ -80,12 +176,115 @@ auto OptionsParser::isVersion() const -> bool {
     return _result.count("version") > 0;
 }
 
+auto OptionsParser::isRun() const -> bool {
+    if (! _parsed) {
+        throw OptionsParserException(NOT_PARSED_MESSAGE);
+    }
+
+    return _result.count("run") > 0;
+}
+
+auto OptionsParser::isTimeReport() const -> bool {
+    if (! _parsed) {
+        throw OptionsParserException(NOT_PARSED_MESSAGE);
+    }
+
+    return _result.count("time-report") > 0;
+}
+
+auto OptionsParser::isTimeTrace() const -> bool {
+    if (! _parsed) {
+        throw OptionsParserException(NOT_PARSED_MESSAGE);
+    }
+
+    return _result.count("time-trace") > 0;
+}
+
+auto OptionsParser::getCacheDirectory() const -> std::string {
+    if (! _parsed) {
+        throw OptionsParserException(NOT_PARSED_MESSAGE);
+    }
+
+    if (_result.count("cache-dir") == 0) {
+        return "";
+    }
+    return _result["cache-dir"].as<std::string>();
+}
+
+auto OptionsParser::getCacheSize() const -> unsigned long {
+    if (! _parsed) {
+        throw OptionsParserException(NOT_PARSED_MESSAGE);
+    }
+
+    return _result["cache-size"].as<unsigned long>();
+}
+
+auto OptionsParser::isCacheStats() const -> bool {
+    if (! _parsed) {
+        throw OptionsParserException(NOT_PARSED_MESSAGE);
+    }
+
+    return _result.count("cache-stats") > 0;
+}
+
+auto OptionsParser::getServerSocket() const -> std::string {
+    if (! _parsed) {
+        throw OptionsParserException(NOT_PARSED_MESSAGE);
+    }
+
+    if (_result.count("server") == 0) {
+        return "";
+    }
+    return _result["server"].as<std::string>();
+}
+
+auto OptionsParser::getConnectSocket() const -> std::string {
+    if (! _parsed) {
+        throw OptionsParserException(NOT_PARSED_MESSAGE);
+    }
+
+    if (_result.count("connect") == 0) {
+        return "";
+    }
+    if (! _separate_connect_socket.empty()) {
+        return _separate_connect_socket;
+    }
+    return _result["connect"].as<std::string>();
+}
+
 auto OptionsParser::getFile() const -> std::string {
     if (! _parsed) {
         throw OptionsParserException(NOT_PARSED_MESSAGE);
     }
 
-    return _result["file"].as<std::string>();
+    const auto files = getFiles();
+    return files.empty() ? "" : files.front();
+}
+
+auto OptionsParser::getFiles() const -> std::vector<std::string> {
+    if (! _parsed) {
+        throw OptionsParserException(NOT_PARSED_MESSAGE);
+    }
+
+    if (_result.count("file") == 0) {
+        return {};
+    }
+    auto files = _result["file"].as<std::vector<std::string>>();
+    if (! _separate_connect_socket.empty()) {
+        const auto connect_socket = std::find(files.begin(), files.end(), _separate_connect_socket);
+        if (connect_socket != files.end()) {
+            files.erase(connect_socket);
+        }
+    }
+    return files;
+}
+
+auto OptionsParser::getJobs() const -> unsigned int {
+    if (! _parsed) {
+        throw OptionsParserException(NOT_PARSED_MESSAGE);
+    }
+
+    return _result["jobs"].as<unsigned int>();
 }
 
 auto OptionsParser::getDump() const -> std::string {
@@ -102,6 +301,133 @@ auto OptionsParser::getDump() const -> std::string {
     return dump;
 }
 
+auto OptionsParser::getEmit() const -> std::string {
+    if (! _parsed) {
+        throw OptionsParserException(NOT_PARSED_MESSAGE);
+    }
+
+    auto emit        = _result["emit"].as<std::string>();
+    const auto valid = {"exe", "obj", "asm", "bc", "ll"};
+    if (std::find(valid.begin(), valid.end(), emit) == valid.end()) {
+        throw OptionsParserException("Emit option value '" + emit + "' is not a valid value");
+    }
+
+    return emit;
+}
+
+auto OptionsParser::getDiagnosticsFormat() const -> std::string {
+    if (! _parsed) {
+        throw OptionsParserException(NOT_PARSED_MESSAGE);
+    }
+
+    auto format      = _result["diagnostics-format"].as<std::string>();
+    const auto valid = {"text", "json", "sarif"};
+    if (std::find(valid.begin(), valid.end(), format) == valid.end()) {
+        throw OptionsParserException("Diagnostics format '" + format + "' is not a valid value");
+    }
+
+    return format;
+}
+
+auto OptionsParser::isWarningsDisabled() const -> bool {
+    if (! _parsed) {
+        throw OptionsParserException(NOT_PARSED_MESSAGE);
+    }
+
+    return _result.count("w") > 0;
+}
+
+auto OptionsParser::isWarningsAsErrors() const -> bool {
+    if (! _parsed) {
+        throw OptionsParserException(NOT_PARSED_MESSAGE);
+    }
+
+    auto warnings_as_errors = false;
+    for (const auto &option : getWarningOptions()) {
+        if (option == "error") {
+            warnings_as_errors = true;
+        } else if (option == "no-error") {
+            warnings_as_errors = false;
+        }
+    }
+
+    return warnings_as_errors;
+}
+
+auto OptionsParser::getDisabledWarnings() const -> std::vector<std::string> {
+    if (! _parsed) {
+        throw OptionsParserException(NOT_PARSED_MESSAGE);
+    }
+
+    std::vector<std::string> codes;
+    for (const auto &option : getWarningOptions()) {
+        if (option != "no-error" && option.rfind("no-", 0) == 0) {
+            codes.push_back(option.substr(3));
+        }
+    }
+
+    return codes;
+}
+
+auto OptionsParser::getMaxDiagnostics() const -> unsigned int {
+    if (! _parsed) {
+        throw OptionsParserException(NOT_PARSED_MESSAGE);
+    }
+
+    return _result["max-diagnostics"].as<unsigned int>();
+}
+
+auto OptionsParser::getWarningOptions() const -> std::vector<std::string> {
+    if (_result.count("W") == 0) {
+        return {};
+    }
+
+    auto options = _result["W"].as<std::vector<std::string>>();
+    for (const auto &option : options) {
+        if (option != "error" && (option.rfind("no-", 0) != 0 || option.length() == 3)) {
+            throw OptionsParserException("Warning option '-W" + option + "' is not a valid value");
+        }
+    }
+
+    return options;
+}
+
+auto OptionsParser::getCpu() const -> std::string {
+    if (! _parsed) {
+        throw OptionsParserException(NOT_PARSED_MESSAGE);
+    }
+
+    if (_result.count("mcpu") == 0) {
+        return "";
+    }
+    return _result["mcpu"].as<std::string>();
+}
+
+auto OptionsParser::getCpuFeatures() const -> std::string {
+    if (! _parsed) {
+        throw OptionsParserException(NOT_PARSED_MESSAGE);
+    }
+
+    if (_result.count("mattr") == 0) {
+        return "";
+    }
+    return _result["mattr"].as<std::string>();
+}
+
+auto OptionsParser::getOptimizationLevel() const -> std::string {
+    if (! _parsed) {
+        throw OptionsParserException(NOT_PARSED_MESSAGE);
+    }
+
+    auto level       = _result["opt-level"].as<std::string>();
+    const auto valid = {"0", "1", "2", "3", "s"};
+    if (std::find(valid.begin(), valid.end(), level) == valid.end()) {
+        throw OptionsParserException("Optimization level '" + level + "' is not a valid value");
+    }
+
+    return level;
+}
+
 auto OptionsParser::showVersion(std::ostream &out) -> void {
     out << FILC_VERSION << "\n";
 }
@@ -114,6 +440,14 @@ auto OptionsParser::getOutputFile() const -> std::string {
     return _result["out"].as<std::string>();
 }
 
+auto OptionsParser::isOutputFileSet() const -> bool {
+    if (! _parsed) {
+        throw OptionsParserException(NOT_PARSED_MESSAGE);
+    }
+
+    return _result.count("out") > 0;
+}
+
 auto OptionsParser::getTarget() const -> std::string {
     if (! _parsed) {
         throw OptionsParserException(NOT_PARSED_MESSAGE);
@@ -0,0 +1,348 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2025-Present Kevin Traini
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "filc/server/CompilerServer.h"
+
+#include "filc/filc.h"
+#include "filc/llvm/IRGenerator.h"
+#include "filc/options/OptionsParser.h"
+
+#include <cerrno>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <iostream>
+#include <limits>
+#include <sstream>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/un.h>
+#include <unistd.h>
+#include <utility>
+
+using namespace filc;
+
+// Wire format, in host byte order (both ends live on the same machine):
+//  request:  string working_directory, uint32 argument count, string arguments...
+//  response: int32 status, string out, string err
+// where a string is a uint32 length followed by its bytes.
+
+namespace {
+auto writeAll(const int socket, const void *data, std::size_t size) -> bool {
+    auto bytes = static_cast<const char *>(data);
+    while (size > 0) {
+        const auto written = write(socket, bytes, size);
+        if (written < 0 && errno == EINTR) {
+            continue;
+        }
+        if (written <= 0) {
+            return false;
+        }
+        bytes += written;
+        size  -= static_cast<std::size_t>(written);
+    }
+
+    return true;
+}
+
+auto readAll(const int socket, void *data, std::size_t size) -> bool {
+    auto bytes = static_cast<char *>(data);
+    while (size > 0) {
+        const auto received = read(socket, bytes, size);
+        if (received < 0 && errno == EINTR) {
+            continue;
+        }
+        if (received <= 0) {
+            return false;
+        }
+        bytes += received;
+        size  -= static_cast<std::size_t>(received);
+    }
+
+    return true;
+}
+
+auto writeString(const int socket, const std::string &value) -> bool {
+    const auto size = static_cast<uint32_t>(value.size());
+    return writeAll(socket, &size, sizeof(size)) && writeAll(socket, value.data(), value.size());
+}
+
+auto readString(const int socket, std::string &value, const uint32_t max_size) -> bool {
+    uint32_t size;
+    if (! readAll(socket, &size, sizeof(size)) || size > max_size) {
+        return false;
+    }
+    value.resize(size);
+    return readAll(socket, value.data(), size);
+}
+
+// A request over these limits is malformed, its connection is dropped before anything is allocated for it
+constexpr uint32_t MAX_REQUEST_ARGUMENTS   = 4096;
+constexpr uint32_t MAX_REQUEST_STRING_SIZE = 64 * 1024;
+
+auto readRequest(const int socket, std::string &working_directory, std::vector<std::string> &arguments) -> bool {
+    uint32_t argument_count;
+    if (! readString(socket, working_directory, MAX_REQUEST_STRING_SIZE)
+        || ! readAll(socket, &argument_count, sizeof(argument_count)) || argument_count == 0
+        || argument_count > MAX_REQUEST_ARGUMENTS) {
+        return false;
+    }
+    arguments.resize(argument_count);
+    for (auto &argument : arguments) {
+        if (! readString(socket, argument, MAX_REQUEST_STRING_SIZE)) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+auto toAddress(const std::string &socket_path, sockaddr_un &address) -> bool {
+    if (socket_path.size() >= sizeof(address.sun_path)) {
+        return false;
+    }
+    std::memset(&address, 0, sizeof(address));
+    address.sun_family = AF_UNIX;
+    std::memcpy(address.sun_path, socket_path.c_str(), socket_path.size() + 1);
+
+    return true;
+}
+
+auto isPeerSameUser(const int socket) -> bool {
+#ifdef SO_PEERCRED
+    ucred credentials {};
+    socklen_t size = sizeof(credentials);
+    if (getsockopt(socket, SOL_SOCKET, SO_PEERCRED, &credentials, &size) != 0) {
+        return false;
+    }
+    return credentials.uid == geteuid();
+#else
+    uid_t uid;
+    gid_t gid;
+    return getpeereid(socket, &uid, &gid) == 0 && uid == geteuid();
+#endif
+}
+
+// Other users must not be able to replace the socket, so its directory is created private and must not be writable
+// by anyone else
+auto prepareSocketDirectory(const std::string &socket_path, std::string &error) -> bool {
+    auto directory = std::filesystem::path(socket_path).parent_path();
+    if (directory.empty()) {
+        directory = ".";
+    }
+    if (mkdir(directory.c_str(), 0700) != 0 && errno != EEXIST) {
+        error = "Could not create " + directory.string() + ": " + std::strerror(errno);
+        return false;
+    }
+
+    struct stat status {};
+    if (lstat(directory.c_str(), &status) != 0 || ! S_ISDIR(status.st_mode) || status.st_uid != geteuid()
+        || (status.st_mode & (S_IWGRP | S_IWOTH)) != 0) {
+        error = "Socket directory " + directory.string()
+                + " must belong to the current user and only be writable by it";
+        return false;
+    }
+
+    return true;
+}
+} // namespace
+
+auto CompilerServer::getDefaultSocketPath() -> std::string {
+    const auto runtime_directory = std::getenv("XDG_RUNTIME_DIR");
+    if (runtime_directory != nullptr && *runtime_directory != '\0') {
+        return (std::filesystem::path(runtime_directory) / "filc.sock").string();
+    }
+    return (std::filesystem::temp_directory_path() / ("filc-" + std::to_string(geteuid())) / "filc.sock").string();
+}
+
+CompilerServer::CompilerServer(std::string socket_path)
+    : _socket_path(std::move(socket_path)), _socket(-1), _stopped(false) {}
+
+CompilerServer::~CompilerServer() {
+    if (_socket >= 0) {
+        close(_socket);
+        unlink(_socket_path.c_str());
+    }
+}
+
+auto CompilerServer::open() -> int {
+    sockaddr_un address {};
+    if (! toAddress(_socket_path, address)) {
+        std::cerr << "Socket path " << _socket_path << " is too long";
+        return 1;
+    }
+
+    std::string error;
+    if (! prepareSocketDirectory(_socket_path, error)) {
+        std::cerr << error;
+        return 1;
+    }
+
+    _socket = socket(AF_UNIX, SOCK_STREAM, 0);
+    if (_socket < 0) {
+        std::cerr << "Could not create socket: " << std::strerror(errno);
+        return 1;
+    }
+
+    // A previous server may have been killed without removing its socket
+    unlink(_socket_path.c_str());
+    if (bind(_socket, reinterpret_cast<sockaddr *>(&address), sizeof(address)) < 0
+        || chmod(_socket_path.c_str(), S_IRUSR | S_IWUSR) < 0 || listen(_socket, SOMAXCONN) < 0) {
+        std::cerr << "Could not listen on " << _socket_path << ": " << std::strerror(errno);
+        return 1;
+    }
+
+    // Pay for host target initialization once, before the first request
+    IRGenerator::initializeTarget(IRGenerator::resolveTarget("", "", "", error).triple, error);
+
+    return 0;
+}
+
+auto CompilerServer::serve() -> int {
+    if (_socket < 0) {
+        throw std::logic_error("open() should be called before serve()");
+    }
+
+    while (! _stopped) {
+        const auto client = accept(_socket, nullptr, nullptr);
+        if (client < 0) {
+            if (errno == EINTR || errno == ECONNABORTED) {
+                continue;
+            }
+            if (_stopped) {
+                break;
+            }
+            std::cerr << "Could not accept connection: " << std::strerror(errno);
+            return 1;
+        }
+
+        // Requests run with the rights of the server, another user could make it read or write any of its files
+        if (! isPeerSameUser(client)) {
+            close(client);
+            continue;
+        }
+        handle(client);
+        close(client);
+    }
+
+    return 0;
+}
+
+auto CompilerServer::stop() -> void {
+    _stopped = true;
+    if (_socket >= 0) {
+        // Wakes up a pending accept()
+        shutdown(_socket, SHUT_RDWR);
+    }
+}
+
+auto CompilerServer::handle(const int client) const -> void {
+    // Paths of the request are relative to the working directory of the client, not of the server
+    std::stringstream out;
+    std::stringstream err;
+    int32_t status;
+    try {
+        std::string working_directory;
+        std::vector<std::string> arguments;
+        if (! readRequest(client, working_directory, arguments)) {
+            return;
+        }
+        std::vector<char *> argv;
+        argv.reserve(arguments.size());
+        for (auto &argument : arguments) {
+            argv.push_back(argument.data());
+        }
+
+        OptionsParser options_parser;
+        options_parser.parse(static_cast<int>(argv.size()), argv.data());
+        if (options_parser.isRun() || ! options_parser.getServerSocket().empty()
+            || ! options_parser.getConnectSocket().empty()) {
+            // A program run by the server would write to its output, and its crash or exit would stop the server
+            err << "--run, --server and --connect can't be handled by the compile server";
+            status = 1;
+        } else {
+            FilCompiler compiler(OptionsParser(), out, err, working_directory);
+            status = compiler.run(static_cast<int>(argv.size()), argv.data());
+        }
+    } catch (std::exception &error) {
+        err << error.what();
+        status = 1;
+    }
+
+    // Nothing more can be done if the client went away
+    if (writeAll(client, &status, sizeof(status)) && writeString(client, out.str())) {
+        writeString(client, err.str());
+    }
+}
+
+CompilerClient::CompilerClient(std::string socket_path): _socket_path(std::move(socket_path)) {}
+
+auto CompilerClient::send(const std::vector<std::string> &arguments, std::ostream &out, std::ostream &err) const
+    -> int {
+    sockaddr_un address {};
+    if (! toAddress(_socket_path, address)) {
+        err << "Socket path " << _socket_path << " is too long";
+        return 1;
+    }
+
+    const auto server = socket(AF_UNIX, SOCK_STREAM, 0);
+    if (server < 0 || connect(server, reinterpret_cast<sockaddr *>(&address), sizeof(address)) < 0) {
+        err << "Could not connect to compile server on " << _socket_path << ": " << std::strerror(errno);
+        if (server >= 0) {
+            close(server);
+        }
+        return 1;
+    }
+    // A server of another user would get the command line and could forge its output
+    if (! isPeerSameUser(server)) {
+        err << "Compile server on " << _socket_path << " is not run by the current user";
+        close(server);
+        return 1;
+    }
+
+    auto sent = writeString(server, std::filesystem::current_path().string());
+    const auto argument_count = static_cast<uint32_t>(arguments.size());
+    sent                      = sent && writeAll(server, &argument_count, sizeof(argument_count));
+    for (const auto &argument : arguments) {
+        sent = sent && writeString(server, argument);
+    }
+
+    int32_t status;
+    std::string server_out;
+    std::string server_err;
+    // The server runs as the same user, its outputs are not limited
+    constexpr auto max_size = std::numeric_limits<uint32_t>::max();
+    const auto received     = sent && readAll(server, &status, sizeof(status))
+                       && readString(server, server_out, max_size) && readString(server, server_err, max_size);
+    close(server);
+    if (! received) {
+        err << "Connection to compile server on " << _socket_path << " was lost";
+        return 1;
+    }
+
+    out << server_out;
+    err << server_err;
+
+    return status;
+}
@@ -0,0 +1,71 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2025-Present Kevin Traini
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "filc/utils/Arena.h"
+
+#include <algorithm>
+#include <cstdint>
+
+using namespace filc;
+
+#define CHUNK_SIZE (64 * 1024)
+
+Arena::Arena(): _current(nullptr), _remaining(0), _allocated_size(0), _object_count(0) {}
+
+Arena::~Arena() {
+    for (auto it = _destructors.rbegin(); it != _destructors.rend(); ++it) {
+        it->second(it->first);
+    }
+}
+
+auto Arena::getAllocatedSize() const -> size_t {
+    return _allocated_size;
+}
+
+auto Arena::getObjectCount() const -> size_t {
+    return _object_count;
+}
+
+auto Arena::getDestructorCount() const -> size_t {
+    return _destructors.size();
+}
+
+auto Arena::allocate(const size_t size, const size_t alignment) -> void * {
+    auto padding = (alignment - reinterpret_cast<uintptr_t>(_current) % alignment) % alignment;
+    if (_current == nullptr || padding + size > _remaining) {
+        // Objects bigger than a chunk get a dedicated one
+        const auto chunk_size = std::max<size_t>(CHUNK_SIZE, size + alignment);
+        _chunks.emplace_back(new char[chunk_size]);
+        _current   = _chunks.back().get();
+        _remaining = chunk_size;
+        padding    = (alignment - reinterpret_cast<uintptr_t>(_current) % alignment) % alignment;
+    }
+
+    const auto memory = _current + padding;
+    _current          += padding + size;
+    _remaining        -= padding + size;
+    _allocated_size   += size;
+    _object_count++;
+
+    return memory;
+}
@@ -0,0 +1,274 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2025-Present Kevin Traini
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "filc/utils/Diagnostics.h"
+
+#include "filc/utils/Message.h"
+#include "filc/utils/utils.h"
+
+#include <algorithm>
+#include <sstream>
+#include <stdexcept>
+#include <utility>
+
+using namespace filc;
+
+namespace {
+auto getLevel(const Severity severity) -> std::string {
+    return severity == Severity::ERROR ? "error" : "warning";
+}
+
+// Code of the note telling how many diagnostics --max-diagnostics dropped, it has no location
+const std::string DROPPED_CODE = "max-diagnostics";
+
+auto writeText(std::ostream &out, const std::vector<Diagnostic> &diagnostics, const std::string &dropped) -> void {
+    for (const auto &diagnostic : diagnostics) {
+        if (diagnostic.severity == Severity::ERROR) {
+            out << Message(ERROR_TAG, diagnostic.message, diagnostic.position, ERROR_COLOR);
+        } else {
+            out << Message(WARNING_TAG, diagnostic.message, diagnostic.position, WARNING_COLOR);
+        }
+    }
+    if (! dropped.empty()) {
+        out << dropped << "\n";
+    }
+}
+
+auto writeJson(std::ostream &out, const std::vector<Diagnostic> &diagnostics, const std::string &dropped) -> void {
+    for (const auto &diagnostic : diagnostics) {
+        const auto start = diagnostic.position.getStartPosition();
+        const auto end   = diagnostic.position.getEndPosition();
+        out << R"({"severity":)" << toJsonString(getLevel(diagnostic.severity))
+            << R"(,"code":)" << toJsonString(diagnostic.code)
+            << R"(,"file":)" << toJsonString(diagnostic.position.getFilename())
+            << R"(,"line":)" << start.first << R"(,"column":)" << start.second
+            << R"(,"end_line":)" << end.first << R"(,"end_column":)" << end.second
+            << R"(,"message":)" << toJsonString(diagnostic.message) << "}\n";
+    }
+    if (! dropped.empty()) {
+        out << R"({"severity":"note","code":)" << toJsonString(DROPPED_CODE) << R"(,"message":)"
+            << toJsonString(dropped) << "}\n";
+    }
+}
+
+// SARIF results of diagnostics, columns are 1-based there
+auto renderSarifResults(
+    std::vector<std::string> &results, const std::vector<Diagnostic> &diagnostics, const std::string &dropped
+) -> void {
+    for (const auto &diagnostic : diagnostics) {
+        const auto start = diagnostic.position.getStartPosition();
+        const auto end   = diagnostic.position.getEndPosition();
+        std::ostringstream result;
+        result << R"({"ruleId":)" << toJsonString(diagnostic.code) << R"(,"level":)"
+               << toJsonString(getLevel(diagnostic.severity)) << R"(,"message":{"text":)"
+               << toJsonString(diagnostic.message) << "}"
+               << R"(,"locations":[{"physicalLocation":{"artifactLocation":{"uri":)"
+               << toJsonString(diagnostic.position.getFilename()) << "}"
+               << R"(,"region":{"startLine":)" << start.first << R"(,"startColumn":)" << start.second + 1
+               << R"(,"endLine":)" << end.first << R"(,"endColumn":)" << end.second + 1 << "}}}]}";
+        results.push_back(result.str());
+    }
+    if (! dropped.empty()) {
+        results.push_back(
+            R"({"ruleId":)" + toJsonString(DROPPED_CODE) + R"(,"level":"note","message":{"text":)"
+            + toJsonString(dropped) + "}}"
+        );
+    }
+}
+}
+
+Diagnostics::Diagnostics(std::ostream &out, const DiagnosticsFormat format)
+    : _out(out), _format(format), _error(false), _warnings_disabled(false), _warnings_as_errors(false),
+      _max_diagnostics(0), _kept(0), _dropped(0), _recording(false) {}
+
+auto Diagnostics::getFormat(const std::string &name) -> DiagnosticsFormat {
+    if (name == "text") {
+        return DiagnosticsFormat::TEXT;
+    }
+    if (name == "json") {
+        return DiagnosticsFormat::JSON;
+    }
+    if (name == "sarif") {
+        return DiagnosticsFormat::SARIF;
+    }
+
+    throw std::logic_error("Unknown diagnostics format: " + name);
+}
+
+auto Diagnostics::disableWarnings() -> void {
+    _warnings_disabled = true;
+}
+
+auto Diagnostics::disableWarning(const std::string &code) -> void {
+    _disabled_warnings.insert(code);
+}
+
+auto Diagnostics::setWarningsAsErrors(const bool warnings_as_errors) -> void {
+    _warnings_as_errors = warnings_as_errors;
+}
+
+auto Diagnostics::setMaxDiagnostics(const unsigned int max_diagnostics) -> void {
+    _max_diagnostics = max_diagnostics;
+}
+
+auto Diagnostics::isWarningEnabled(const std::string &code) const -> bool {
+    return ! _warnings_disabled && _disabled_warnings.find(code) == _disabled_warnings.end();
+}
+
+auto Diagnostics::report(Severity severity, std::string code, std::string message, const Position &position)
+    -> void {
+    if (severity == Severity::WARNING) {
+        if (! isWarningEnabled(code)) {
+            return;
+        }
+    }
+    if (_recording) {
+        _reported.push_back({severity, code, message, position});
+    }
+    if (severity == Severity::WARNING) {
+        if (_warnings_as_errors) {
+            severity = Severity::ERROR;
+        }
+    }
+    if (severity == Severity::ERROR) {
+        _error = true;
+    }
+
+    if (_max_diagnostics != 0 && _kept >= _max_diagnostics) {
+        _dropped++;
+        return;
+    }
+    _kept++;
+    _pending.push_back({severity, std::move(code), std::move(message), position});
+}
+
+auto Diagnostics::getPending() const -> const std::vector<Diagnostic> & {
+    return _pending;
+}
+
+auto Diagnostics::hasError() const -> bool {
+    return _error;
+}
+
+auto Diagnostics::flush() -> void {
+    if (_pending.empty() && _dropped == 0) {
+        return;
+    }
+
+    std::string dropped;
+    if (_dropped > 0) {
+        dropped = std::to_string(_dropped) + " more diagnostics not shown, limit of " + std::to_string(_max_diagnostics)
+                + " reached";
+    }
+
+    std::ostringstream rendered;
+    switch (_format) {
+    case DiagnosticsFormat::TEXT:
+        writeText(rendered, _pending, dropped);
+        break;
+    case DiagnosticsFormat::JSON:
+        writeJson(rendered, _pending, dropped);
+        break;
+    case DiagnosticsFormat::SARIF:
+        // Kept for writeSarifLog, an invocation prints a single log
+        renderSarifResults(_sarif_results, _pending, dropped);
+        break;
+    }
+    _out << rendered.str();
+    _pending.clear();
+    _dropped = 0;
+}
+
+auto Diagnostics::recordReported() -> void {
+    _recording = true;
+}
+
+auto Diagnostics::serializeReported() const -> std::string {
+    // One header line per diagnostic, followed by its code and message whose lengths are in the header
+    std::ostringstream serialized;
+    for (const auto &diagnostic : _reported) {
+        const auto start = diagnostic.position.getStartPosition();
+        const auto end   = diagnostic.position.getEndPosition();
+        serialized << (diagnostic.severity == Severity::ERROR ? 'E' : 'W') << " "
+                   << (diagnostic.position.getFilename().empty() ? 0 : 1) << " " << start.first << " " << start.second
+                   << " " << end.first << " " << end.second << " " << diagnostic.code.size() << " "
+                   << diagnostic.message.size() << "\n"
+                   << diagnostic.code << diagnostic.message;
+    }
+
+    return serialized.str();
+}
+
+auto Diagnostics::replay(const std::string &serialized, const SourceBuffer *source) -> bool {
+    std::istringstream in(serialized);
+    char severity;
+    while (in >> severity) {
+        int located;
+        std::pair<unsigned int, unsigned int> start;
+        std::pair<unsigned int, unsigned int> end;
+        std::size_t code_size;
+        std::size_t message_size;
+        in >> located >> start.first >> start.second >> end.first >> end.second >> code_size >> message_size;
+        if (! in || in.get() != '\n' || code_size + message_size > serialized.size()) {
+            return false;
+        }
+        std::string code(code_size, '\0');
+        std::string message(message_size, '\0');
+        in.read(code.data(), static_cast<std::streamsize>(code_size));
+        in.read(message.data(), static_cast<std::streamsize>(message_size));
+        if (! in) {
+            return false;
+        }
+        report(
+            severity == 'E' ? Severity::ERROR : Severity::WARNING,
+            std::move(code),
+            std::move(message),
+            located != 0 ? Position(source, start, end) : Position()
+        );
+    }
+
+    return true;
+}
+
+auto Diagnostics::writeSarifLog(std::ostream &out, const std::vector<const Diagnostics *> &diagnostics) -> void {
+    const auto has_results = std::any_of(diagnostics.begin(), diagnostics.end(), [](const auto *file_diagnostics) {
+        return ! file_diagnostics->_sarif_results.empty();
+    });
+    if (! has_results) {
+        return;
+    }
+
+    // SARIF 2.1.0 log with a single run holding the results of every file
+    std::ostringstream rendered;
+    rendered << R"({"version":"2.1.0","$schema":"https://json.schemastore.org/sarif-2.1.0.json","runs":[{)"
+             << R"("tool":{"driver":{"name":"filc","version":)" << toJsonString(FILC_VERSION) << R"(}},"results":[)";
+    auto first = true;
+    for (const auto *file_diagnostics : diagnostics) {
+        for (const auto &result : file_diagnostics->_sarif_results) {
+            rendered << (first ? "" : ",") << result;
+            first = false;
+        }
+    }
+    rendered << "]}]}\n";
+    out << rendered.str();
+}
@@ -0,0 +1,112 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2025-Present Kevin Traini
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "filc/utils/SourceBuffer.h"
+
+#include <cerrno>
+#include <cstring>
+#include <fcntl.h>
+#include <stdexcept>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <utility>
+
+using namespace filc;
+
+auto SourceBuffer::open(const std::string &filename) -> std::unique_ptr<SourceBuffer> {
+    const auto fd = ::open(filename.c_str(), O_RDONLY);
+    struct stat status {};
+    if (fd < 0 || fstat(fd, &status) != 0 || ! S_ISREG(status.st_mode)) {
+        if (fd >= 0) {
+            close(fd);
+        }
+        throw std::logic_error("File '" + filename + "' not found");
+    }
+
+    const auto size = static_cast<size_t>(status.st_size);
+    if (size == 0) {
+        close(fd);
+        return std::make_unique<SourceBuffer>(filename, "");
+    }
+
+    // The mapping stays valid once the file descriptor is closed
+    const auto data = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (data == MAP_FAILED) {
+        throw std::logic_error("File '" + filename + "' can't be mapped: " + std::strerror(errno));
+    }
+    madvise(data, size, MADV_SEQUENTIAL);
+
+    return std::unique_ptr<SourceBuffer>(new SourceBuffer(filename, static_cast<const char *>(data), size));
+}
+
+SourceBuffer::SourceBuffer(std::string name, std::string content)
+    : _name(std::move(name)), _owned_content(std::move(content)), _data(_owned_content.data()),
+      _size(_owned_content.size()), _mapped(false) {
+    indexLines();
+}
+
+SourceBuffer::SourceBuffer(std::string name, const char *data, const size_t size)
+    : _name(std::move(name)), _data(data), _size(size), _mapped(true) {
+    indexLines();
+}
+
+SourceBuffer::~SourceBuffer() {
+    if (_mapped) {
+        munmap(const_cast<char *>(_data), _size);
+    }
+}
+
+auto SourceBuffer::getName() const -> const std::string & {
+    return _name;
+}
+
+auto SourceBuffer::getContent() const -> std::string_view {
+    return {_data, _size};
+}
+
+auto SourceBuffer::getLineCount() const -> size_t {
+    return _line_offsets.size();
+}
+
+auto SourceBuffer::getLine(const size_t line) const -> std::string_view {
+    if (line == 0 || line > _line_offsets.size()) {
+        return {};
+    }
+
+    const auto start = _line_offsets[line - 1];
+    const auto end   = line < _line_offsets.size() ? _line_offsets[line] - 1 : _size;
+
+    return {_data + start, end - start};
+}
+
+auto SourceBuffer::indexLines() -> void {
+    _line_offsets.push_back(0);
+    const auto end = _data + _size;
+    auto current   = static_cast<const char *>(std::memchr(_data, '\n', _size));
+    while (current != nullptr) {
+        _line_offsets.push_back(current + 1 - _data);
+        current = static_cast<const char *>(std::memchr(current + 1, '\n', end - current - 1));
+    }
+}
@@ -0,0 +1,65 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2025-Present Kevin Traini
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "filc/utils/SourceManager.h"
+
+#include <stdexcept>
+#include <utility>
+
+using namespace filc;
+
+SourceManager::SourceManager() = default;
+
+auto SourceManager::load(const std::string &filename) -> const SourceBuffer * {
+    const std::lock_guard<std::mutex> lock(_mutex);
+    auto &buffer = _buffers[filename];
+    if (buffer == nullptr) {
+        try {
+            buffer = SourceBuffer::open(filename);
+        } catch (...) {
+            _buffers.erase(filename);
+            throw;
+        }
+    }
+
+    return buffer.get();
+}
+
+auto SourceManager::add(const std::string &name, std::string content) -> const SourceBuffer * {
+    const std::lock_guard<std::mutex> lock(_mutex);
+    auto &buffer = _buffers[name];
+    if (buffer != nullptr) {
+        // Positions may already point to it
+        throw std::logic_error("Source '" + name + "' is already registered");
+    }
+    buffer = std::make_unique<SourceBuffer>(name, std::move(content));
+
+    return buffer.get();
+}
+
+auto SourceManager::find(const std::string &name) const -> const SourceBuffer * {
+    const std::lock_guard<std::mutex> lock(_mutex);
+    const auto it = _buffers.find(name);
+
+    return it != _buffers.end() ? it->second.get() : nullptr;
+}
@@ -0,0 +1,179 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2025-Present Kevin Traini
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "filc/utils/TimeReport.h"
+
+#include "filc/utils/utils.h"
+
+#include <algorithm>
+#include <ctime>
+#include <iomanip>
+#include <sys/resource.h>
+#include <unistd.h>
+
+using namespace filc;
+
+namespace {
+// CPU time of the calling thread, files compiled concurrently don't count each other
+auto getCpuTime() -> std::chrono::microseconds {
+    timespec time {};
+    clock_gettime(CLOCK_THREAD_CPUTIME_ID, &time);
+
+    return std::chrono::seconds(time.tv_sec) + std::chrono::duration_cast<std::chrono::microseconds>(
+               std::chrono::nanoseconds(time.tv_nsec)
+           );
+}
+
+auto getMaxRss() -> long {
+    rusage usage {};
+    getrusage(RUSAGE_SELF, &usage);
+
+    return usage.ru_maxrss;
+}
+
+auto toMilliseconds(const std::chrono::microseconds duration) -> double {
+    return static_cast<double>(duration.count()) / 1000.0;
+}
+
+auto writeRow(std::ostream &out, const std::string &name, const double wall, const double cpu, const long rss)
+    -> void {
+    out << std::left << std::setw(20) << name << std::right << std::fixed << std::setprecision(3) << std::setw(12)
+        << wall << std::setw(12) << cpu << std::setprecision(1) << std::setw(18)
+        << static_cast<double>(rss) / 1024.0 << "\n";
+}
+}
+
+TimeReport::TimeReport(std::string name): _name(std::move(name)), _start(std::chrono::steady_clock::now()) {}
+
+auto TimeReport::now() const -> std::chrono::microseconds {
+    return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - _start);
+}
+
+auto TimeReport::addPhase(TimedPhase phase) -> void {
+    _phases.push_back(std::move(phase));
+}
+
+auto TimeReport::setCounter(const std::string &name, const size_t value) -> void {
+    const auto it = std::find_if(_counters.begin(), _counters.end(), [&name](const auto &counter) {
+        return counter.first == name;
+    });
+    if (it != _counters.end()) {
+        it->second = value;
+    } else {
+        _counters.emplace_back(name, value);
+    }
+}
+
+auto TimeReport::addSection(const std::string &title, std::string content) -> void {
+    _sections.emplace_back(title, std::move(content));
+}
+
+auto TimeReport::getPhases() const -> const std::vector<TimedPhase> & {
+    return _phases;
+}
+
+auto TimeReport::getCounters() const -> const std::vector<std::pair<std::string, size_t>> & {
+    return _counters;
+}
+
+auto TimeReport::write(std::ostream &out) const -> void {
+    const auto flags     = out.flags();
+    const auto precision = out.precision();
+
+    out << "=== Time report: " << _name << " ===\n";
+    out << std::left << std::setw(20) << "Phase" << std::right << std::setw(12) << "Wall (ms)" << std::setw(12)
+        << "CPU (ms)" << std::setw(18) << "RSS growth (MiB)" << "\n";
+    std::chrono::microseconds total_wall(0);
+    std::chrono::microseconds total_cpu(0);
+    long total_rss_growth = 0;
+    for (const auto &phase : _phases) {
+        writeRow(
+            out, phase.name, toMilliseconds(phase.wall_time), toMilliseconds(phase.cpu_time), phase.max_rss_growth_kib
+        );
+        total_wall       += phase.wall_time;
+        total_cpu        += phase.cpu_time;
+        total_rss_growth += phase.max_rss_growth_kib;
+    }
+    writeRow(out, "Total", toMilliseconds(total_wall), toMilliseconds(total_cpu), total_rss_growth);
+    out.flags(flags);
+    out.precision(precision);
+
+    for (const auto &[name, value] : _counters) {
+        out << name << ": " << value << "\n";
+    }
+    for (const auto &[title, content] : _sections) {
+        if (! content.empty()) {
+            out << "=== " << title << " ===\n" << content;
+        }
+    }
+}
+
+auto TimeReport::writeTrace(std::ostream &out) const -> void {
+    const auto pid = getpid();
+    out << R"({"traceEvents":[)";
+    out << R"({"name":"process_name","ph":"M","pid":)" << pid << R"(,"tid":0,"args":{"name":"filc"}})";
+    for (const auto &phase : _phases) {
+        out << R"(,{"name":)" << toJsonString(phase.name) << R"(,"ph":"X","pid":)" << pid << R"(,"tid":0,"ts":)"
+            << phase.start.count() << R"(,"dur":)" << phase.wall_time.count() << R"(,"args":{"detail":)"
+            << toJsonString(_name) << "}}";
+    }
+    if (! _phases.empty()) {
+        const auto &last = _phases.back();
+        out << R"(,{"name":"Total","ph":"X","pid":)" << pid << R"(,"tid":0,"ts":)" << _phases.front().start.count()
+            << R"(,"dur":)" << (last.start + last.wall_time - _phases.front().start).count() << R"(,"args":{"detail":)"
+            << toJsonString(_name) << "}}";
+    }
+    if (! _counters.empty()) {
+        out << R"(,{"name":"Counters","ph":"C","pid":)" << pid << R"(,"tid":0,"ts":)" << now().count()
+            << R"(,"args":{)";
+        for (auto it = _counters.begin(); it != _counters.end(); ++it) {
+            out << (it != _counters.begin() ? "," : "") << toJsonString(it->first) << ":" << it->second;
+        }
+        out << "}}";
+    }
+    out << R"(],"displayTimeUnit":"ms"})" << "\n";
+}
+
+TimeScope::TimeScope(TimeReport *report, std::string name)
+    : _report(report), _name(std::move(name)), _start(0), _cpu_start(0), _max_rss_start(0) {
+    if (_report != nullptr) {
+        _start         = _report->now();
+        _cpu_start     = getCpuTime();
+        _max_rss_start = getMaxRss();
+    }
+}
+
+TimeScope::~TimeScope() {
+    stop();
+}
+
+auto TimeScope::stop() -> void {
+    if (_report == nullptr) {
+        return;
+    }
+
+    const auto end            = _report->now();
+    const auto max_rss_growth = getMaxRss() - _max_rss_start;
+    _report->addPhase({std::move(_name), _start, end - _start, getCpuTime() - _cpu_start, max_rss_growth});
+    _report = nullptr;
+}
@@ -23,6 +23,8 @@
  */
 #include "filc/utils/utils.h"
 
+#include <cstdio>
+
 auto filc::parseEscapedChar(const std::string &value) -> char {
     if (value.length() == 2 && value[0] == '\\') {
         // An escaped char \\ + ['"?abfnrtv\\]
@@ -56,3 +58,38 @@ auto filc::parseEscapedChar(const std::string &value) -> char {
 
     return value[0];
 }
+
+auto filc::toJsonString(const std::string &value) -> std::string {
+    std::string result = "\"";
+    result.reserve(value.length() + 2);
+    for (const auto character : value) {
+        switch (character) {
+        case '"':
+            result += "\\\"";
+            break;
+        case '\\':
+            result += "\\\\";
+            break;
+        case '\n':
+            result += "\\n";
+            break;
+        case '\r':
+            result += "\\r";
+            break;
+        case '\t':
+            result += "\\t";
+            break;
+        default:
+            if (static_cast<unsigned char>(character) < 0x20) {
+                char escaped[7];
+                std::snprintf(escaped, sizeof(escaped), "\\u%04x", static_cast<unsigned int>(character));
+                result += escaped;
+            } else {
+                result += character;
+            }
+            break;
+        }
+    }
+
+    return result + "\"";
+}
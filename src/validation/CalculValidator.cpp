@@ -23,102 +23,45 @@
  */
 #include "filc/validation/CalculValidator.h"
 
-#include <algorithm>
-#include <vector>
-
 using namespace filc;
 
+namespace {
+// X: invalid operation, L: result has the type of the left operand, B: result is a bool
+enum CalculResult : unsigned char { X, L, B };
+
+// Indexed by [TypeClass][BinaryOperator]
+constexpr CalculResult CALCUL_RESULTS[TYPE_CLASS_COUNT][BINARY_OPERATOR_COUNT] = {
+  //                 %  +  -  /  *  <  <= >  >= == != && ||
+  /* SIGNED_INT   */ {L, L, L, L, L, B, B, B, B, B, B, X, X},
+  /* UNSIGNED_INT */ {L, L, L, L, L, B, B, B, B, B, B, X, X},
+  /* FLOAT        */ {L, L, L, L, L, B, B, B, B, B, B, X, X},
+  /* BOOL         */ {X, X, X, X, X, X, X, X, X, B, B, B, B},
+  /* POINTER      */ {X, L, X, X, X, X, X, X, X, B, B, X, X},
+  /* OTHER        */ {X, X, X, X, X, X, X, X, X, X, X, X, X},
+};
+} // namespace
+
 CalculValidator::CalculValidator(Environment *environment): _environment(environment) {}
 
 auto CalculValidator::isCalculValid(
     const std::shared_ptr<AbstractType> &left_type,
-    const std::string &op,
-    const std::shared_ptr<AbstractType> &right_type
-) const -> std::shared_ptr<AbstractType> {
-    const auto left_name  = left_type->getName();
-    const auto right_name = right_type->getName();
-
-    const std::vector<std::string> numeric_type = {
-      "i8",
-      "i16",
-      "i32",
-      "i64",
-      "i128",
-      "u8",
-      "u16",
-      "u32",
-      "u64",
-      "u128",
-      "f32",
-      "f64",
-    };
-    if (std::find(numeric_type.begin(), numeric_type.end(), left_name) != numeric_type.end()
-        && left_type == right_type) {
-        return isNumericOperatorValid(left_type, op);
-    }
-
-    if (left_name == "bool" && left_type == right_type) {
-        return isBoolOperatorValid(op);
-    }
-
-    if (left_name[left_name.length() - 1] == '*') { // A pointer
-        return isPointerOperatorValid(op, left_type, right_type);
-    }
-
-    // We don't know what it is, so we assert it cannot be done
-    return nullptr;
-}
-
-auto CalculValidator::isNumericOperatorValid(const std::shared_ptr<AbstractType> &left_type, const std::string &op)
-    const -> std::shared_ptr<AbstractType> {
-    const std::vector<std::string> numeric_op = {"%", "+", "-", "/", "*"};
-    const std::vector<std::string> boolean_op = {"<", "<=", ">", ">=", "==", "!="};
-
-    if (std::find(numeric_op.begin(), numeric_op.end(), op) != numeric_op.end()) {
-        return left_type;
-    }
-
-    if (std::find(boolean_op.begin(), boolean_op.end(), op) != boolean_op.end()) {
-        return _environment->getType("bool");
-    }
-
-    return nullptr;
-}
-
-auto CalculValidator::isBoolOperatorValid(const std::string &op) const -> std::shared_ptr<AbstractType> {
-    if (op == "&&" || op == "||" || op == "==" || op == "!=") {
-        return _environment->getType("bool");
-    }
-
-    return nullptr;
-}
-
-auto CalculValidator::isPointerOperatorValid(
-    const std::string &op,
-    const std::shared_ptr<AbstractType> &left_type,
+    const BinaryOperator op,
     const std::shared_ptr<AbstractType> &right_type
 ) const -> std::shared_ptr<AbstractType> {
-    if ((op == "==" || op == "!=") && left_type == right_type) {
-        return _environment->getType("bool");
+    const auto type_class = left_type->getTraits().type_class;
+    const auto result     = CALCUL_RESULTS[static_cast<std::size_t>(type_class)][static_cast<std::size_t>(op)];
+    if (result == X) {
+        return nullptr;
     }
 
-    if (op == "+") {
-        const std::vector<std::string> integer_type = {
-          "i8",
-          "i16",
-          "i32",
-          "i64",
-          "i128",
-          "u8",
-          "u16",
-          "u32",
-          "u64",
-          "u128",
-        };
-        if (std::find(integer_type.begin(), integer_type.end(), right_type->getName()) != integer_type.end()) {
-            return left_type;
+    if (type_class == TypeClass::POINTER && op == BinaryOperator::PLUS) {
+        // Pointer arithmetic: the offset can be any integer
+        if (! right_type->getTraits().isInteger()) {
+            return nullptr;
         }
+    } else if (left_type != right_type) {
+        return nullptr;
     }
 
-    return nullptr;
+    return result == L ? left_type : _environment->getBoolType();
 }
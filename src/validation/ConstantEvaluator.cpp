@@ -0,0 +1,279 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2025-Present Kevin Traini
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "filc/validation/ConstantEvaluator.h"
+
+#include "filc/grammar/identifier/Identifier.h"
+#include "filc/grammar/pointer/Pointer.h"
+
+using namespace filc;
+
+namespace {
+auto toBool(const bool value) -> ConstantValue {
+    return ConstantValue(llvm::APInt(1, value ? 1 : 0));
+}
+
+// Same conversions as the code generated for literals
+auto literalValue(const Expression *expression) -> std::optional<ConstantValue> {
+    switch (expression->getKind()) {
+        case ExpressionKind::BOOLEAN_LITERAL:
+            return toBool(static_cast<const BooleanLiteral *>(expression)->getValue());
+        case ExpressionKind::INTEGER_LITERAL: {
+            const auto &traits = expression->getType()->getTraits();
+            const auto value   = static_cast<const IntegerLiteral *>(expression)->getValue();
+            return ConstantValue(llvm::APInt(traits.bit_width, value, traits.is_signed_int));
+        }
+        case ExpressionKind::FLOAT_LITERAL: {
+            const auto value = static_cast<const FloatLiteral *>(expression)->getValue();
+            if (expression->getType()->getTraits().bit_width == 32) {
+                return ConstantValue(llvm::APFloat(static_cast<float>(value)));
+            }
+            return ConstantValue(llvm::APFloat(value));
+        }
+        case ExpressionKind::CHARACTER_LITERAL:
+            return ConstantValue(llvm::APInt(8, static_cast<const CharacterLiteral *>(expression)->getValue(), false));
+        default:
+            return std::nullopt;
+    }
+}
+} // namespace
+
+ConstantEvaluator::ConstantEvaluator(Environment *environment): _environment(environment) {}
+
+auto ConstantEvaluator::getConstant(const Expression *expression) const -> std::optional<ConstantValue> {
+    const auto literal = literalValue(expression);
+    if (literal.has_value()) {
+        return literal;
+    }
+
+    const auto constant = _environment->getConstant(expression);
+    if (constant == nullptr) {
+        return std::nullopt;
+    }
+    return *constant;
+}
+
+auto ConstantEvaluator::getNameConstant(const std::string &name) const -> std::optional<ConstantValue> {
+    const auto found = _constant_names.find(name);
+    if (found == _constant_names.end()) {
+        return std::nullopt;
+    }
+    return getConstant(found->second);
+}
+
+auto ConstantEvaluator::fold(const Expression *expression, const ConstantValue &value) -> EvaluationStatus {
+    _environment->setConstant(expression, value);
+    return EvaluationStatus::FOLDED;
+}
+
+auto ConstantEvaluator::evaluate(const Expression *expression) -> EvaluationStatus {
+    switch (expression->getKind()) {
+        case ExpressionKind::BOOLEAN_LITERAL:
+        case ExpressionKind::FLOAT_LITERAL:
+        case ExpressionKind::CHARACTER_LITERAL:
+            return EvaluationStatus::FOLDED;
+        case ExpressionKind::INTEGER_LITERAL:
+            return evaluateIntegerLiteral(static_cast<const IntegerLiteral *>(expression));
+        case ExpressionKind::VARIABLE_DECLARATION:
+            return evaluateVariable(static_cast<const VariableDeclaration *>(expression));
+        case ExpressionKind::IDENTIFIER: {
+            const auto constant = getNameConstant(static_cast<const Identifier *>(expression)->getName());
+            if (! constant.has_value()) {
+                return EvaluationStatus::NOT_CONSTANT;
+            }
+            return fold(expression, *constant);
+        }
+        case ExpressionKind::BINARY_CALCUL:
+            return evaluateCalcul(static_cast<const BinaryCalcul *>(expression));
+        case ExpressionKind::POINTER:
+            // Each new allocates, its address is only equal to itself. Skipping it must not skip a side effect.
+            if (! getConstant(static_cast<const Pointer *>(expression)->getValue()).has_value()) {
+                return EvaluationStatus::NOT_CONSTANT;
+            }
+            return fold(expression, ConstantValue(expression));
+        case ExpressionKind::VARIABLE_ADDRESS:
+            // Each & allocates a copy of the variable, as for new
+            if (static_cast<const VariableAddress *>(expression)->getVariable()->getKind()
+                != ExpressionKind::IDENTIFIER) {
+                return EvaluationStatus::NOT_CONSTANT;
+            }
+            return fold(expression, ConstantValue(expression));
+        default:
+            return EvaluationStatus::NOT_CONSTANT;
+    }
+}
+
+auto ConstantEvaluator::evaluateIntegerLiteral(const IntegerLiteral *literal) -> EvaluationStatus {
+    const auto &traits = literal->getType()->getTraits();
+    const auto value   = literal->getValue();
+    const auto fits    = traits.is_signed_int ? llvm::APInt(64, value, true).isSignedIntN(traits.bit_width)
+                                              : value >= 0 && llvm::APInt(64, value).isIntN(traits.bit_width);
+    return fits ? EvaluationStatus::FOLDED : EvaluationStatus::WRAPPED;
+}
+
+auto ConstantEvaluator::evaluateVariable(const VariableDeclaration *variable) -> EvaluationStatus {
+    // The declaration itself is never folded, the name it binds would be missing from the generated code
+    if (variable->isConstant() && getConstant(variable->getValue()).has_value()) {
+        _constant_names[variable->getName()] = variable->getValue();
+    }
+    return EvaluationStatus::NOT_CONSTANT;
+}
+
+auto ConstantEvaluator::evaluateCalcul(const BinaryCalcul *calcul) -> EvaluationStatus {
+    const auto left  = getConstant(calcul->getLeftExpression());
+    const auto right = getConstant(calcul->getRightExpression());
+    if (! left.has_value() || ! right.has_value()) {
+        return EvaluationStatus::NOT_CONSTANT;
+    }
+
+    const auto &traits = calcul->getLeftExpression()->getType()->getTraits();
+    switch (traits.type_class) {
+        case TypeClass::SIGNED_INT:
+        case TypeClass::UNSIGNED_INT:
+            return evaluateIntegerCalcul(calcul, left->getInteger(), right->getInteger(), traits.is_signed_int);
+        case TypeClass::FLOAT:
+            return evaluateFloatCalcul(calcul, left->getFloat(), right->getFloat());
+        case TypeClass::BOOL:
+            return evaluateBoolCalcul(calcul, left->getInteger(), right->getInteger());
+        case TypeClass::POINTER: {
+            // An offset address is not an allocation, only comparisons are folded
+            const auto operation = calcul->getOperator();
+            if ((operation != BinaryOperator::EQEQ && operation != BinaryOperator::NEQ) || ! right->isAddress()) {
+                return EvaluationStatus::NOT_CONSTANT;
+            }
+            const auto same = left->getAddress() == right->getAddress();
+            return fold(calcul, toBool(operation == BinaryOperator::EQEQ ? same : ! same));
+        }
+        default:
+            return EvaluationStatus::NOT_CONSTANT;
+    }
+}
+
+auto ConstantEvaluator::evaluateIntegerCalcul(
+    const BinaryCalcul *calcul, const llvm::APInt &left, const llvm::APInt &right, const bool is_signed
+) -> EvaluationStatus {
+    bool overflow = false;
+    switch (calcul->getOperator()) {
+        case BinaryOperator::MOD:
+        case BinaryOperator::DIV: {
+            if (right.isZero()) {
+                return EvaluationStatus::DIVISION_BY_ZERO;
+            }
+            if (is_signed && left.isMinSignedValue() && right.isAllOnes()) {
+                return EvaluationStatus::DIVISION_OVERFLOW;
+            }
+            if (calcul->getOperator() == BinaryOperator::MOD) {
+                return fold(calcul, ConstantValue(is_signed ? left.srem(right) : left.urem(right)));
+            }
+            return fold(calcul, ConstantValue(is_signed ? left.sdiv(right) : left.udiv(right)));
+        }
+        case BinaryOperator::PLUS:
+            fold(calcul, ConstantValue(is_signed ? left.sadd_ov(right, overflow) : left.uadd_ov(right, overflow)));
+            break;
+        case BinaryOperator::MINUS:
+            fold(calcul, ConstantValue(is_signed ? left.ssub_ov(right, overflow) : left.usub_ov(right, overflow)));
+            break;
+        case BinaryOperator::STAR:
+            fold(calcul, ConstantValue(is_signed ? left.smul_ov(right, overflow) : left.umul_ov(right, overflow)));
+            break;
+        case BinaryOperator::LT:
+            return fold(calcul, toBool(is_signed ? left.slt(right) : left.ult(right)));
+        case BinaryOperator::LTE:
+            return fold(calcul, toBool(is_signed ? left.sle(right) : left.ule(right)));
+        case BinaryOperator::GT:
+            return fold(calcul, toBool(is_signed ? left.sgt(right) : left.ugt(right)));
+        case BinaryOperator::GTE:
+            return fold(calcul, toBool(is_signed ? left.sge(right) : left.uge(right)));
+        case BinaryOperator::EQEQ:
+            return fold(calcul, toBool(left == right));
+        case BinaryOperator::NEQ:
+            return fold(calcul, toBool(left != right));
+        default:
+            return EvaluationStatus::NOT_CONSTANT;
+    }
+
+    return overflow ? EvaluationStatus::WRAPPED : EvaluationStatus::FOLDED;
+}
+
+auto ConstantEvaluator::evaluateFloatCalcul(
+    const BinaryCalcul *calcul, const llvm::APFloat &left, const llvm::APFloat &right
+) -> EvaluationStatus {
+    // Comparisons are ordered, any of them involving a NaN is false
+    const auto comparison = left.compare(right);
+    auto result           = left;
+    switch (calcul->getOperator()) {
+        case BinaryOperator::MOD:
+            result.mod(right);
+            return fold(calcul, ConstantValue(result));
+        case BinaryOperator::PLUS:
+            result.add(right, llvm::APFloat::rmNearestTiesToEven);
+            return fold(calcul, ConstantValue(result));
+        case BinaryOperator::MINUS:
+            result.subtract(right, llvm::APFloat::rmNearestTiesToEven);
+            return fold(calcul, ConstantValue(result));
+        case BinaryOperator::DIV:
+            result.divide(right, llvm::APFloat::rmNearestTiesToEven);
+            return fold(calcul, ConstantValue(result));
+        case BinaryOperator::STAR:
+            result.multiply(right, llvm::APFloat::rmNearestTiesToEven);
+            return fold(calcul, ConstantValue(result));
+        case BinaryOperator::LT:
+            return fold(calcul, toBool(comparison == llvm::APFloat::cmpLessThan));
+        case BinaryOperator::LTE:
+            return fold(
+                calcul, toBool(comparison == llvm::APFloat::cmpLessThan || comparison == llvm::APFloat::cmpEqual)
+            );
+        case BinaryOperator::GT:
+            return fold(calcul, toBool(comparison == llvm::APFloat::cmpGreaterThan));
+        case BinaryOperator::GTE:
+            return fold(
+                calcul, toBool(comparison == llvm::APFloat::cmpGreaterThan || comparison == llvm::APFloat::cmpEqual)
+            );
+        case BinaryOperator::EQEQ:
+            return fold(calcul, toBool(comparison == llvm::APFloat::cmpEqual));
+        case BinaryOperator::NEQ:
+            return fold(
+                calcul,
+                toBool(comparison == llvm::APFloat::cmpLessThan || comparison == llvm::APFloat::cmpGreaterThan)
+            );
+        default:
+            return EvaluationStatus::NOT_CONSTANT;
+    }
+}
+
+auto ConstantEvaluator::evaluateBoolCalcul(
+    const BinaryCalcul *calcul, const llvm::APInt &left, const llvm::APInt &right
+) -> EvaluationStatus {
+    switch (calcul->getOperator()) {
+        case BinaryOperator::EQEQ:
+            return fold(calcul, toBool(left == right));
+        case BinaryOperator::NEQ:
+            return fold(calcul, toBool(left != right));
+        case BinaryOperator::AND:
+            return fold(calcul, ConstantValue(left & right));
+        case BinaryOperator::OR:
+            return fold(calcul, ConstantValue(left | right));
+        default:
+            return EvaluationStatus::NOT_CONSTANT;
+    }
+}
@@ -0,0 +1,68 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2025-Present Kevin Traini
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "filc/validation/ConstantValue.h"
+
+#include <llvm/IR/Constants.h>
+
+using namespace filc;
+
+ConstantValue::ConstantValue(llvm::APInt integer): _value(std::move(integer)) {}
+
+ConstantValue::ConstantValue(llvm::APFloat real): _value(std::move(real)) {}
+
+ConstantValue::ConstantValue(const Expression *allocation): _value(allocation) {}
+
+auto ConstantValue::isInteger() const -> bool {
+    return std::holds_alternative<llvm::APInt>(_value);
+}
+
+auto ConstantValue::isFloat() const -> bool {
+    return std::holds_alternative<llvm::APFloat>(_value);
+}
+
+auto ConstantValue::isAddress() const -> bool {
+    return std::holds_alternative<const Expression *>(_value);
+}
+
+auto ConstantValue::getInteger() const -> const llvm::APInt & {
+    return std::get<llvm::APInt>(_value);
+}
+
+auto ConstantValue::getFloat() const -> const llvm::APFloat & {
+    return std::get<llvm::APFloat>(_value);
+}
+
+auto ConstantValue::getAddress() const -> const Expression * {
+    return std::get<const Expression *>(_value);
+}
+
+auto ConstantValue::toLLVMConstant(llvm::LLVMContext *context) const -> llvm::Constant * {
+    if (isInteger()) {
+        return llvm::ConstantInt::get(*context, getInteger());
+    }
+    if (isFloat()) {
+        return llvm::ConstantFP::get(*context, getFloat());
+    }
+    return nullptr;
+}
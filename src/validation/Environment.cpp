@@ -52,6 +52,12 @@ Environment::Environment() {
     addType(std::make_shared<PointerType>(getType("char")));
 
     addType(std::make_shared<Type>("void"));
+
+    _bool_type   = getType("bool");
+    _int_type    = getType("int");
+    _float_type  = getType("f64");
+    _char_type   = getType("char");
+    _string_type = getType("char*");
 }
 
 auto Environment::prepareLLVMTypes(llvm::LLVMContext *context) const -> void {
@@ -95,7 +101,100 @@ auto Environment::addType(const std::shared_ptr<AbstractType> &type) -> void {
     if (hasType(type->getDisplayName())) {
         throw std::logic_error("Environment already have type " + type->getDisplayName() + " aka " + type->getName());
     }
+    internType(type.get());
     _types[type->getDisplayName()] = type;
+
+    if (type->getTraits().is_pointer) {
+        _pointer_types.emplace(type->getTraits().element_type->getId(), type);
+    }
+}
+
+auto Environment::getPointerType(const std::shared_ptr<AbstractType> &pointed_type)
+    -> const std::shared_ptr<AbstractType> & {
+    if (pointed_type->getId() == 0) {
+        throw std::logic_error("Environment doesn't have type " + pointed_type->toDisplay());
+    }
+
+    const auto found = _pointer_types.find(pointed_type->getId());
+    if (found != _pointer_types.end()) {
+        return found->second;
+    }
+
+    addType(std::make_shared<PointerType>(pointed_type));
+    return _pointer_types.at(pointed_type->getId());
+}
+
+auto Environment::getBoolType() const -> const std::shared_ptr<AbstractType> & {
+    return _bool_type;
+}
+
+auto Environment::getIntType() const -> const std::shared_ptr<AbstractType> & {
+    return _int_type;
+}
+
+auto Environment::getFloatType() const -> const std::shared_ptr<AbstractType> & {
+    return _float_type;
+}
+
+auto Environment::getCharType() const -> const std::shared_ptr<AbstractType> & {
+    return _char_type;
+}
+
+auto Environment::getStringType() const -> const std::shared_ptr<AbstractType> & {
+    return _string_type;
+}
+
+auto Environment::internType(AbstractType *type) -> void {
+    const auto canonical_name = type->getName();
+    const auto found          = _type_ids.find(canonical_name);
+    if (found != _type_ids.end()) {
+        type->_id = found->second;
+    } else {
+        type->_id                  = static_cast<unsigned int>(_type_ids.size()) + 1;
+        _type_ids[canonical_name] = type->_id;
+    }
+    type->_traits = computeTraits(type);
+}
+
+auto Environment::computeTraits(const AbstractType *type) -> TypeTraits {
+    TypeTraits traits;
+
+    if (const auto alias_type = dynamic_cast<const AliasType *>(type)) {
+        const auto aliased_type = alias_type->getAliasedType();
+        return aliased_type->getId() != 0 ? aliased_type->getTraits() : computeTraits(aliased_type.get());
+    }
+
+    if (const auto pointer_type = dynamic_cast<const PointerType *>(type)) {
+        traits.is_pointer   = true;
+        traits.element_type = pointer_type->getPointedType().get();
+        traits.type_class   = TypeClass::POINTER;
+        return traits;
+    }
+
+    if (const auto array_type = dynamic_cast<const ArrayType *>(type)) {
+        traits.is_array     = true;
+        traits.element_type = array_type->getContainedType().get();
+        return traits;
+    }
+
+    const auto name = type->getName();
+    if (name == "bool") {
+        traits.is_bool    = true;
+        traits.bit_width  = 1;
+        traits.type_class = TypeClass::BOOL;
+    } else if (name == "f32" || name == "f64") {
+        traits.is_float   = true;
+        traits.bit_width  = std::stoi(name.substr(1));
+        traits.type_class = TypeClass::FLOAT;
+    } else if (name.size() > 1 && (name[0] == 'i' || name[0] == 'u')
+               && name.find_first_not_of("0123456789", 1) == std::string::npos) {
+        traits.is_signed_int   = name[0] == 'i';
+        traits.is_unsigned_int = name[0] == 'u';
+        traits.bit_width       = std::stoi(name.substr(1));
+        traits.type_class      = traits.is_signed_int ? TypeClass::SIGNED_INT : TypeClass::UNSIGNED_INT;
+    }
+
+    return traits;
 }
 
 auto Environment::hasName(const std::string &name) const -> bool {
@@ -122,3 +221,15 @@ auto Environment::setName(const Name &name) -> void {
     }
     _names[name.getName()] = name;
 }
+
+auto Environment::getConstant(const Expression *expression) const -> const ConstantValue * {
+    const auto found = _constants.find(expression);
+    if (found == _constants.end()) {
+        return nullptr;
+    }
+    return &found->second;
+}
+
+auto Environment::setConstant(const Expression *expression, const ConstantValue &value) -> void {
+    _constants.insert_or_assign(expression, value);
+}
@@ -23,6 +23,7 @@
  */
 #include "filc/validation/ValidationVisitor.h"
 
+#include "filc/grammar/Dispatch.h"
 #include "filc/grammar/array/Array.h"
 #include "filc/grammar/assignation/Assignation.h"
 #include "filc/grammar/calcul/Calcul.h"
@@ -31,158 +32,173 @@
 #include "filc/grammar/pointer/Pointer.h"
 #include "filc/grammar/program/Program.h"
 #include "filc/grammar/variable/Variable.h"
-#include "filc/utils/Message.h"
 #include "filc/validation/CalculValidator.h"
 
+#include <cctype>
+#include <llvm/ADT/StringExtras.h>
 #include <llvm/IR/DerivedTypes.h>
 
 using namespace filc;
 
-ValidationVisitor::ValidationVisitor(std::ostream &out)
-    : _context(new VisitorContext()), _environment(new Environment()), _type_builder(_environment.get()), _out(out),
-      _error(false) {}
+ValidationVisitor::ValidationVisitor(Diagnostics &diagnostics)
+    : _environment(new Environment()),
+      _type_builder(_environment.get()),
+      _evaluator(_environment.get()),
+      _diagnostics(diagnostics) {}
 
 auto ValidationVisitor::getEnvironment() const -> const Environment * {
     return _environment.get();
 }
 
 auto ValidationVisitor::hasError() const -> bool {
-    return _error;
+    return _diagnostics.hasError();
 }
 
-auto ValidationVisitor::displayError(const std::string &message, const Position &position) -> void {
-    _error = true;
-    _out << Message(ERROR, message, position, ERROR_COLOR);
+auto ValidationVisitor::displayError(const std::string &code, const std::string &message, const Position &position)
+    -> void {
+    _diagnostics.report(Severity::ERROR, code, message, position);
 }
 
-auto ValidationVisitor::displayWarning(const std::string &message, const Position &position) const -> void {
-    _out << Message(WARNING, message, position, WARNING_COLOR);
+auto ValidationVisitor::displayWarning(const std::string &code, const char *message, const Position &position) -> void {
+    // Suppressed warnings are dropped before their message is even copied
+    if (! _diagnostics.isWarningEnabled(code)) {
+        return;
+    }
+    _diagnostics.report(Severity::WARNING, code, message, position);
 }
 
 auto ValidationVisitor::visitProgram(Program *program) -> void {
-    auto expressions = program->getExpressions();
+    const auto &expressions = program->getExpressions();
     for (auto it = expressions.begin(); it != expressions.end(); ++it) {
         if (it + 1 == expressions.end()) {
-            _context->set("return", true);
+            _context.top().return_used = true;
         }
 
-        (*it)->acceptVoidVisitor(this);
+        dispatch(this, *it);
 
         if (it + 1 == expressions.end()) {
-            const auto expected = _environment->getType("int");
-            const std::vector<std::string> allowed_types
-                = {"i8", "i16", "i32", "i64", "i128", "u8", "u16", "u32", "u64", "u128", "bool"};
+            const auto &expected  = _environment->getIntType();
             const auto found_type = (*it)->getType();
             if (found_type == nullptr) {
                 return;
             }
 
-            if (std::find(allowed_types.begin(), allowed_types.end(), found_type->getName()) == allowed_types.end()) {
+            if (! found_type->getTraits().isInteger() && ! found_type->getTraits().is_bool) {
                 displayError(
+                    "type-mismatch",
                     "Expected type " + expected->toDisplay() + " but got " + found_type->toDisplay(),
                     (*it)->getPosition()
                 );
             }
         }
 
-        _context->clear();
+        _context.clear();
     }
 }
 
 auto ValidationVisitor::visitBooleanLiteral(BooleanLiteral *literal) -> void {
-    literal->setType(_environment->getType("bool"));
+    literal->setType(_environment->getBoolType());
 
-    if (! _context->has("return") || ! _context->get<bool>("return")) {
-        displayWarning("Boolean value not used", literal->getPosition());
+    if (! _context.top().return_used) {
+        displayWarning("unused-value", "Boolean value not used", literal->getPosition());
     }
 }
 
 auto ValidationVisitor::visitIntegerLiteral(IntegerLiteral *literal) -> void {
-    if (_context->has("cast_type")) {
-        const auto cast_type                   = _context->get<std::shared_ptr<AbstractType>>("cast_type");
-        std::vector<std::string> allowed_casts = {"i8", "i16", "i32", "i64", "i128", "u8", "u16", "u32", "u64", "u128"};
-        if (std::find(allowed_casts.begin(), allowed_casts.end(), cast_type->getName()) != allowed_casts.end()) {
+    const auto &cast_type = _context.top().cast_type;
+    if (cast_type != nullptr) {
+        if (cast_type->getTraits().isInteger()) {
             literal->setType(cast_type);
         } else {
-            literal->setType(_environment->getType("int"));
+            literal->setType(_environment->getIntType());
         }
     } else {
-        literal->setType(_environment->getType("int"));
+        literal->setType(_environment->getIntType());
+    }
+
+    if (_evaluator.evaluate(literal) == EvaluationStatus::WRAPPED) {
+        displayWarning(
+            "constant-overflow", "Integer value does not fit in its type, it is truncated", literal->getPosition()
+        );
     }
 
-    if (! _context->has("return") || ! _context->get<bool>("return")) {
-        displayWarning("Integer value not used", literal->getPosition());
+    if (! _context.top().return_used) {
+        displayWarning("unused-value", "Integer value not used", literal->getPosition());
     }
 }
 
 auto ValidationVisitor::visitFloatLiteral(FloatLiteral *literal) -> void {
-    if (_context->has("cast_type")) {
-        const auto cast_type                   = _context->get<std::shared_ptr<AbstractType>>("cast_type");
-        std::vector<std::string> allowed_casts = {"f32", "f64"};
-        if (std::find(allowed_casts.begin(), allowed_casts.end(), cast_type->getName()) != allowed_casts.end()) {
+    const auto &cast_type = _context.top().cast_type;
+    if (cast_type != nullptr) {
+        if (cast_type->getTraits().is_float) {
             literal->setType(cast_type);
         } else {
-            literal->setType(_environment->getType("f64"));
+            literal->setType(_environment->getFloatType());
         }
     } else {
-        literal->setType(_environment->getType("f64"));
+        literal->setType(_environment->getFloatType());
     }
 
-    if (! _context->has("return") || ! _context->get<bool>("return")) {
-        displayWarning("Float value not used", literal->getPosition());
+    if (! _context.top().return_used) {
+        displayWarning("unused-value", "Float value not used", literal->getPosition());
     }
 }
 
 auto ValidationVisitor::visitCharacterLiteral(CharacterLiteral *literal) -> void {
-    literal->setType(_environment->getType("char"));
+    literal->setType(_environment->getCharType());
 
-    if (! _context->has("return") || ! _context->get<bool>("return")) {
-        displayWarning("Character value not used", literal->getPosition());
+    if (! _context.top().return_used) {
+        displayWarning("unused-value", "Character value not used", literal->getPosition());
     }
 }
 
 auto ValidationVisitor::visitStringLiteral(StringLiteral *literal) -> void {
-    literal->setType(_environment->getType("char*"));
+    literal->setType(_environment->getStringType());
 
-    if (! _context->has("return") || ! _context->get<bool>("return")) {
-        displayWarning("String value not used", literal->getPosition());
+    if (! _context.top().return_used) {
+        displayWarning("unused-value", "String value not used", literal->getPosition());
     }
 }
 
 auto ValidationVisitor::visitVariableDeclaration(VariableDeclaration *variable) -> void {
     if (_environment->hasName(variable->getName())) {
-        displayError(variable->getName() + " is already defined", variable->getPosition());
+        displayError("redefinition", variable->getName() + " is already defined", variable->getPosition());
         return;
     }
 
     if (variable->isConstant() && variable->getValue() == nullptr) {
-        displayError("When declaring a constant, you must provide it a value", variable->getPosition());
+        displayError(
+            "missing-value", "When declaring a constant, you must provide it a value", variable->getPosition()
+        );
         return;
     }
 
     std::shared_ptr<AbstractType> variable_type = nullptr;
-    if (! variable->getTypeName().empty()) {
-        if (! _environment->hasType(variable->getTypeName()) && ! _type_builder.tryBuildType(variable->getTypeName())) {
-            displayError("Unknown type: " + variable->getTypeName(), variable->getPosition());
+    auto type_name                              = variable->getTypeName();
+    if (! type_name.empty()) {
+        if (! resolveArraySize(type_name, variable->getPosition())) {
+            return;
+        }
+        if (! _environment->hasType(type_name) && ! _type_builder.tryBuildType(type_name)) {
+            displayError("unknown-type", "Unknown type: " + type_name, variable->getPosition());
             return;
         }
-        variable_type = _environment->getType(variable->getTypeName());
+        variable_type = _environment->getType(type_name);
     }
 
     if (variable->getValue() != nullptr) {
-        _context->stack();
-        _context->set("return", true);
-        if (variable_type != nullptr) {
-            _context->set("cast_type", variable_type);
-        }
-        variable->getValue()->acceptVoidVisitor(this);
-        _context->unstack();
+        auto &frame       = _context.stack();
+        frame.return_used = true;
+        frame.cast_type   = variable_type;
+        dispatch(this, variable->getValue());
+        _context.unstack();
         const auto value_type = variable->getValue()->getType();
         if (value_type == nullptr) {
             return;
         }
-        if (variable_type != nullptr && variable_type->getName() != value_type->getName()) {
+        if (variable_type != nullptr && variable_type != value_type) {
             displayError(
+                "type-mismatch",
                 "Cannot assign value of type " + value_type->toDisplay() + " to a variable of type "
                     + variable_type->toDisplay(),
                 variable->getPosition()
@@ -194,7 +210,11 @@ auto ValidationVisitor::visitVariableDeclaration(VariableDeclaration *variable)
     }
 
     if (variable_type == nullptr) {
-        displayError("When declaring a variable, you must provide at least a type or a value", variable->getPosition());
+        displayError(
+            "missing-type",
+            "When declaring a variable, you must provide at least a type or a value",
+            variable->getPosition()
+        );
         return;
     }
 
@@ -202,41 +222,94 @@ auto ValidationVisitor::visitVariableDeclaration(VariableDeclaration *variable)
     _environment->addName(
         Name(variable->isConstant(), variable->getName(), variable_type, variable->getValue() != nullptr)
     );
+    _evaluator.evaluate(variable);
+}
+
+auto ValidationVisitor::resolveArraySize(std::string &type_name, const Position &position) -> bool {
+    const auto open = type_name.rfind('[');
+    if (type_name.back() != ']' || open == std::string::npos) {
+        return true;
+    }
+    const auto size_name = type_name.substr(open + 1, type_name.size() - open - 2);
+    if (size_name.empty() || std::isdigit(static_cast<unsigned char>(size_name[0]))) {
+        return true;
+    }
+
+    const auto constant = _evaluator.getNameConstant(size_name);
+    if (! constant.has_value() || ! _environment->getName(size_name).getType()->getTraits().isInteger()) {
+        displayError("invalid-array-size", "Size of an array must be a constant integer: " + size_name, position);
+        return false;
+    }
+    const auto &size     = constant->getInteger();
+    const auto is_signed = _environment->getName(size_name).getType()->getTraits().is_signed_int;
+    // TypeBuilder reads sizes as int
+    if ((is_signed && size.isNegative()) || ! size.isIntN(31)) {
+        displayError(
+            "invalid-array-size",
+            "Size of an array must be between 0 and 2147483647, " + size_name + " is "
+                + llvm::toString(size, 10, is_signed),
+            position
+        );
+        return false;
+    }
+
+    type_name = type_name.substr(0, open + 1) + std::to_string(size.getZExtValue()) + "]";
+    return true;
 }
 
 auto ValidationVisitor::visitIdentifier(Identifier *identifier) -> void {
     if (! _environment->hasName(identifier->getName())) {
-        displayError("Unknown name, don't know what it refers to: " + identifier->getName(), identifier->getPosition());
+        displayError(
+            "unknown-name",
+            "Unknown name, don't know what it refers to: " + identifier->getName(),
+            identifier->getPosition()
+        );
         return;
     }
 
     const auto name = _environment->getName(identifier->getName());
     if (! name.hasValue()) {
         displayError(
+            "uninitialized-variable",
             "Variable " + identifier->getName() + " has no value, please set one before accessing it",
             identifier->getPosition()
         );
         return;
     }
     identifier->setType(name.getType());
+    _evaluator.evaluate(identifier);
 
-    if (! _context->has("return") || ! _context->get<bool>("return")) {
-        displayWarning("Value not used", identifier->getPosition());
+    if (! _context.top().return_used) {
+        displayWarning("unused-value", "Value not used", identifier->getPosition());
     }
 }
 
 auto ValidationVisitor::visitBinaryCalcul(BinaryCalcul *calcul) -> void {
-    _context->stack();
-    _context->set("return", true);
-    calcul->getLeftExpression()->acceptVoidVisitor(this);
+    // Left operands are walked from the innermost calcul instead of recursing, long chains would overflow the stack
+    const auto chain     = calcul->getLeftChain();
+    const auto innermost = chain.empty() ? calcul : chain.back();
+
+    _context.stack().return_used = true;
+    dispatch(this, innermost->getLeftExpression());
+    _context.unstack();
+
+    for (auto it = chain.rbegin(); it != chain.rend(); it++) {
+        validateOperation(*it);
+    }
+    validateOperation(calcul);
+
+    if (calcul->getType() != nullptr && ! _context.top().return_used) {
+        displayWarning("unused-value", "Value not used", calcul->getPosition());
+    }
+}
+
+auto ValidationVisitor::validateOperation(BinaryCalcul *calcul) -> void {
     const auto left_type = calcul->getLeftExpression()->getType();
-    _context->unstack();
 
-    _context->stack();
-    _context->set("return", true);
-    calcul->getRightExpression()->acceptVoidVisitor(this);
+    _context.stack().return_used = true;
+    dispatch(this, calcul->getRightExpression());
     const auto right_type = calcul->getRightExpression()->getType();
-    _context->unstack();
+    _context.unstack();
 
     if (left_type == nullptr || right_type == nullptr) {
         return;
@@ -246,8 +319,9 @@ auto ValidationVisitor::visitBinaryCalcul(BinaryCalcul *calcul) -> void {
     const auto found_type = validator.isCalculValid(left_type, calcul->getOperator(), right_type);
     if (found_type == nullptr) {
         displayError(
-            "You cannot use operator " + calcul->getOperator() + " with " + left_type->toDisplay() + " and "
-                + right_type->toDisplay(),
+            "invalid-operands",
+            "You cannot use operator " + toString(calcul->getOperator()) + " with " + left_type->toDisplay()
+                + " and " + right_type->toDisplay(),
             calcul->getPosition()
         );
         return;
@@ -255,35 +329,54 @@ auto ValidationVisitor::visitBinaryCalcul(BinaryCalcul *calcul) -> void {
 
     calcul->setType(found_type);
 
-    if (! _context->has("return") || ! _context->get<bool>("return")) {
-        displayWarning("Value not used", calcul->getPosition());
+    switch (_evaluator.evaluate(calcul)) {
+        case EvaluationStatus::WRAPPED:
+            displayWarning(
+                "constant-overflow", "Result does not fit in its type, it wraps around", calcul->getPosition()
+            );
+            break;
+        case EvaluationStatus::DIVISION_BY_ZERO:
+            displayError("division-by-zero", "Division by zero", calcul->getPosition());
+            break;
+        case EvaluationStatus::DIVISION_OVERFLOW:
+            displayError(
+                "division-overflow",
+                "Division of the minimum value of " + found_type->toDisplay() + " by -1 overflows",
+                calcul->getPosition()
+            );
+            break;
+        default:
+            break;
     }
 }
 
 auto ValidationVisitor::visitAssignation(Assignation *assignation) -> void {
     if (! _environment->hasName(assignation->getIdentifier())) {
         displayError(
-            "Unknown name, don't know what it refers to: " + assignation->getIdentifier(), assignation->getPosition()
+            "unknown-name",
+            "Unknown name, don't know what it refers to: " + assignation->getIdentifier(),
+            assignation->getPosition()
         );
         return;
     }
     auto name = _environment->getName(assignation->getIdentifier());
     if (name.isConstant()) {
-        displayError("Cannot modify a constant", assignation->getPosition());
+        displayError("constant-assignment", "Cannot modify a constant", assignation->getPosition());
         return;
     }
 
-    _context->stack();
-    _context->set("return", true);
-    _context->set("cast_type", name.getType());
-    assignation->getValue()->acceptVoidVisitor(this);
-    _context->unstack();
+    auto &frame       = _context.stack();
+    frame.return_used = true;
+    frame.cast_type   = name.getType();
+    dispatch(this, assignation->getValue());
+    _context.unstack();
     const auto value_type = assignation->getValue()->getType();
     if (value_type == nullptr) {
         return;
     }
-    if (value_type->getName() != name.getType()->getName()) {
+    if (value_type != name.getType()) {
         displayError(
+            "type-mismatch",
             "Cannot assign value of type " + value_type->toDisplay() + " to a variable of type "
                 + name.getType()->toDisplay(),
             assignation->getPosition()
@@ -298,27 +391,21 @@ auto ValidationVisitor::visitAssignation(Assignation *assignation) -> void {
 
 auto ValidationVisitor::visitPointer(Pointer *pointer) -> void {
     if (! _environment->hasType(pointer->getTypeName())) {
-        displayError("Unknown type: " + pointer->getTypeName(), pointer->getPosition());
+        displayError("unknown-type", "Unknown type: " + pointer->getTypeName(), pointer->getPosition());
         return;
     }
     const auto pointed_type = _environment->getType(pointer->getTypeName());
 
-    std::shared_ptr<AbstractType> pointer_type = nullptr;
-    if (_environment->hasType(pointer->getTypeName() + "*")) {
-        pointer_type = _environment->getType(pointer->getTypeName() + "*");
-    } else {
-        pointer_type = std::make_shared<PointerType>(pointed_type);
-        _environment->addType(pointer_type);
-    }
+    const auto pointer_type = _environment->getPointerType(pointed_type);
 
-    _context->stack();
-    _context->set("return", true);
-    pointer->getValue()->acceptVoidVisitor(this);
-    _context->unstack();
+    _context.stack().return_used = true;
+    dispatch(this, pointer->getValue());
+    _context.unstack();
 
     const auto value_type = pointer->getValue()->getType();
-    if (value_type->getName() != pointed_type->getName()) {
+    if (value_type != pointed_type) {
         displayError(
+            "type-mismatch",
             "Cannot assign a value of type " + value_type->toDisplay() + " to a pointer to type "
                 + pointed_type->toDisplay(),
             pointer->getPosition()
@@ -327,17 +414,17 @@ auto ValidationVisitor::visitPointer(Pointer *pointer) -> void {
     }
 
     pointer->setType(pointer_type);
+    _evaluator.evaluate(pointer);
 
-    if (! _context->has("return") || ! _context->get<bool>("return")) {
-        displayWarning("Value not used", pointer->getPosition());
+    if (! _context.top().return_used) {
+        displayWarning("unused-value", "Value not used", pointer->getPosition());
     }
 }
 
 auto ValidationVisitor::visitPointerDereferencing(PointerDereferencing *pointer) -> void {
-    _context->stack();
-    _context->set("return", true);
-    pointer->getPointer()->acceptVoidVisitor(this);
-    _context->unstack();
+    _context.stack().return_used = true;
+    dispatch(this, pointer->getPointer());
+    _context.unstack();
 
     const auto pointer_type = pointer->getPointer()->getType();
     if (pointer_type == nullptr) {
@@ -345,47 +432,42 @@ auto ValidationVisitor::visitPointerDereferencing(PointerDereferencing *pointer)
     }
     const auto type = std::dynamic_pointer_cast<PointerType>(pointer_type);
     if (type == nullptr) {
-        displayError("Cannot dereference a variable which is not a pointer", pointer->getPosition());
+        displayError(
+            "invalid-dereference", "Cannot dereference a variable which is not a pointer", pointer->getPosition()
+        );
         return;
     }
 
     pointer->setType(type->getPointedType());
 
-    if (! _context->has("return") || ! _context->get<bool>("return")) {
-        displayWarning("Value not used", pointer->getPosition());
+    if (! _context.top().return_used) {
+        displayWarning("unused-value", "Value not used", pointer->getPosition());
     }
 }
 
 auto ValidationVisitor::visitVariableAddress(VariableAddress *address) -> void {
-    _context->stack();
-    _context->set("return", true);
-    address->getVariable()->acceptVoidVisitor(this);
-    _context->unstack();
+    _context.stack().return_used = true;
+    dispatch(this, address->getVariable());
+    _context.unstack();
 
     const auto pointed_type = address->getVariable()->getType();
     if (pointed_type == nullptr) {
         return;
     }
-    std::shared_ptr<AbstractType> type = nullptr;
-    if (_environment->hasType(pointed_type->getName() + "*")) {
-        type = _environment->getType(pointed_type->getName() + "*");
-    } else {
-        type = std::make_shared<PointerType>(pointed_type);
-        _environment->addType(type);
-    }
-
-    address->setType(type);
+    address->setType(_environment->getPointerType(pointed_type));
+    _evaluator.evaluate(address);
 
-    if (! _context->has("return") || ! _context->get<bool>("return")) {
-        displayWarning("Value not used", address->getPosition());
+    if (! _context.top().return_used) {
+        displayWarning("unused-value", "Value not used", address->getPosition());
     }
 }
 
 auto ValidationVisitor::visitArray(Array *array) -> void {
+    const auto cast_type = _context.top().cast_type;
     if (array->getSize() == 0) {
         array->setFullSize(0);
-        if (_context->has("cast_type")) {
-            array->setType(_context->get<std::shared_ptr<AbstractType>>("cast_type"));
+        if (cast_type != nullptr) {
+            array->setType(cast_type);
         } else {
             if (! _environment->hasType("void[0]")) {
                 _environment->addType(std::make_shared<ArrayType>(0, _environment->getType("void")));
@@ -393,26 +475,26 @@ auto ValidationVisitor::visitArray(Array *array) -> void {
             array->setType(_environment->getType("void[0]"));
         }
     } else {
-        if (_context->has("cast_type")) {
-            const auto cast_type  = _context->get<std::shared_ptr<AbstractType>>("cast_type");
+        if (cast_type != nullptr) {
             const auto array_type = std::dynamic_pointer_cast<ArrayType>(cast_type);
             if (array_type == nullptr) {
                 displayError(
+                    "type-mismatch",
                     "Cannot cast an array to a type not corresponding to an array: " + cast_type->toDisplay(),
                     array->getPosition()
                 );
                 return;
             }
 
-            _context->stack();
-            _context->set("cast_type", array_type->getContainedType());
-            _context->set("return", true);
+            auto &frame       = _context.stack();
+            frame.return_used = true;
+            frame.cast_type   = array_type->getContainedType();
         }
 
         std::vector<std::shared_ptr<AbstractType>> values_types;
         unsigned long full_size = 0;
         for (const auto &value : array->getValues()) {
-            value->acceptVoidVisitor(this);
+            dispatch(this, value);
 
             const auto value_type = value->getType();
             if (value_type == nullptr) {
@@ -420,22 +502,29 @@ auto ValidationVisitor::visitArray(Array *array) -> void {
             }
             values_types.push_back(value_type);
 
-            if (_context->has("array_size")) {
-                full_size += _context->get<unsigned long>("array_size");
-                _context->unset("array_size");
+            auto &frame = _context.top();
+            if (frame.has_array_size) {
+                full_size            += frame.array_size;
+                frame.has_array_size = false;
             } else {
                 full_size++;
             }
         }
         array->setFullSize(full_size);
 
-        if (_context->has("cast_type")) {
-            _context->unstack();
+        if (cast_type != nullptr) {
+            _context.unstack();
         }
 
-        const auto it = std::adjacent_find(values_types.begin(), values_types.end(), std::not_equal_to<>());
+        const auto it = std::adjacent_find(
+            values_types.begin(),
+            values_types.end(),
+            [](const std::shared_ptr<AbstractType> &a, const std::shared_ptr<AbstractType> &b) {
+                return a->getId() != b->getId();
+            }
+        );
         if (it != values_types.end()) {
-            displayError("All values of an array should be of the same type", array->getPosition());
+            displayError("type-mismatch", "All values of an array should be of the same type", array->getPosition());
             return;
         }
 
@@ -446,16 +535,17 @@ auto ValidationVisitor::visitArray(Array *array) -> void {
         array->setType(_environment->getType(type_name));
     }
 
-    _context->set("array_size", array->getFullSize());
+    _context.top().has_array_size = true;
+    _context.top().array_size     = array->getFullSize();
 
-    if (! _context->has("return") || ! _context->get<bool>("return")) {
-        displayWarning("Value not used", array->getPosition());
+    if (! _context.top().return_used) {
+        displayWarning("unused-value", "Value not used", array->getPosition());
     }
 }
 
 auto ValidationVisitor::visitArrayAccess(ArrayAccess *array_access) -> void {
     const auto array = array_access->getArray();
-    array->acceptVoidVisitor(this);
+    dispatch(this, array);
 
     const auto array_type = array->getType();
     if (array_type == nullptr) {
@@ -464,13 +554,16 @@ auto ValidationVisitor::visitArrayAccess(ArrayAccess *array_access) -> void {
     const auto type = std::dynamic_pointer_cast<ArrayType>(array_type);
     if (type == nullptr) {
         displayError(
-            "Cannot access to offset on a variable of type " + array_type->toDisplay(), array_access->getPosition()
+            "invalid-access",
+            "Cannot access to offset on a variable of type " + array_type->toDisplay(),
+            array_access->getPosition()
         );
         return;
     }
 
     if (array_access->getIndex() >= type->getSize()) {
         displayError(
+            "out-of-bounds",
             "Out of bound access to an array. Array has a size of " + std::to_string(type->getSize()),
             array_access->getPosition()
         );
@@ -479,7 +572,7 @@ auto ValidationVisitor::visitArrayAccess(ArrayAccess *array_access) -> void {
 
     array_access->setType(type->getContainedType());
 
-    if (! _context->has("return") || ! _context->get<bool>("return")) {
-        displayWarning("Value not used", array_access->getPosition());
+    if (! _context.top().return_used) {
+        displayWarning("unused-value", "Value not used", array_access->getPosition());
     }
 }
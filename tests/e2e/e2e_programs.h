@@ -0,0 +1,70 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2025-Present Kevin Traini
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef FILC_E2E_PROGRAMS_H
+#define FILC_E2E_PROGRAMS_H
+
+#include <vector>
+
+struct E2EProgram {
+    const char *source;
+    int result;
+};
+
+// Programs run by ir_dump e2e tests. The perf gate compiles them as well, they must keep parsing without full
+// context prediction.
+
+inline const std::vector<E2EProgram> CALCUL_PROGRAMS = {
+    {"1 + 1", 2},
+    {"(3 * 2 + 4) / 2", 5},
+};
+
+inline const std::vector<E2EProgram> VARIABLE_PROGRAMS = {
+    {"val foo = 2\nfoo", 2},
+};
+
+inline const std::vector<E2EProgram> POINTER_PROGRAMS = {
+    {"val foo = new i32(3);*foo", 3},
+    {"val foo = 4;val bar = &foo;*bar", 4},
+    {"val foo = new i32(3);**&*&foo", 3},
+    {"val foo = new i32(2);val bar = new i32(3);*(foo + 1)", 3},
+};
+
+inline const std::vector<E2EProgram> ARRAY_PROGRAMS = {
+    {"val foo = [1, 2, 3];foo[1]", 2},
+    {"[4, 5, 6][2]", 6},
+    {"[[1, 2, 3], [4, 5, 6], [7, 8, 9]][1][1]", 5},
+    {"[[[0, 1, 2], [3, 4, 5], [6, 7, 8]], [[9, 0, 1], [2, 3, 4], [5, 6, 7]], [[8, 9, 0], [1, 2, 3], [4, 5, "
+     "6]]][2][1][0]",
+     1},
+};
+
+inline auto allE2EPrograms() -> std::vector<E2EProgram> {
+    std::vector<E2EProgram> programs;
+    for (const auto *group : {&CALCUL_PROGRAMS, &VARIABLE_PROGRAMS, &POINTER_PROGRAMS, &ARRAY_PROGRAMS}) {
+        programs.insert(programs.end(), group->begin(), group->end());
+    }
+    return programs;
+}
+
+#endif // FILC_E2E_PROGRAMS_H
@@ -21,6 +21,7 @@
  * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
  * SOFTWARE.
  */
+#include "e2e_programs.h"
 #include "test_tools.h"
 
 #include <cstdlib>
@@ -28,61 +29,114 @@
 #include <fstream>
 #include <gtest/gtest.h>
 
-auto getProgramResult(const std::string &program) -> int {
-    std::ofstream program_file(FIXTURES_PATH "/ir_test.fil");
+auto getProgramResult(const std::string &program, const std::string &options = "") -> int {
+    const auto program_path = temporary_file("ir_test.fil");
+    const auto ir_path      = temporary_file("ir_test.ir");
+    std::ofstream program_file(program_path);
     program_file << program;
     program_file.flush();
     program_file.close();
 
-    const auto ir_output = run_with_args("--dump=ir " FIXTURES_PATH "/ir_test.fil 2>&1");
-    std::ofstream ir_file(FIXTURES_PATH "/ir_test.ir");
+    const auto command   = FILC_BIN " --dump=ir " + options + " " + program_path + " 2>&1";
+    const auto ir_output = exec_output(command.c_str());
+    std::ofstream ir_file(ir_path);
     ir_file << ir_output;
     ir_file.flush();
     ir_file.close();
 
-    const auto status = system(LLI_BIN " " FIXTURES_PATH "/ir_test.ir");
+    const auto status = system((LLI_BIN " " + ir_path).c_str());
 
-    std::filesystem::remove(FIXTURES_PATH "/ir_test.fil");
-    std::filesystem::remove(FIXTURES_PATH "/ir_test.ir");
+    std::filesystem::remove(program_path);
+    std::filesystem::remove(ir_path);
 
     return WEXITSTATUS(status);
 }
 
+auto getJitResult(const std::string &program, const std::string &options = "") -> int {
+    const auto program_path = temporary_file("jit_test.fil");
+    std::ofstream program_file(program_path);
+    program_file << program;
+    program_file.flush();
+    program_file.close();
+
+    const auto command = FILC_BIN " --run " + options + " " + program_path;
+    const auto status  = system(command.c_str());
+
+    std::filesystem::remove(program_path);
+
+    return WEXITSTATUS(status);
+}
+
+auto getExecutableResult(const std::string &program) -> int {
+    const auto program_path    = temporary_file("exe_test.fil");
+    const auto executable_path = temporary_file("exe_test");
+    std::ofstream program_file(program_path);
+    program_file << program;
+    program_file.flush();
+    program_file.close();
+
+    const auto compile_status = system((FILC_BIN " -o " + executable_path + " " + program_path).c_str());
+    const auto status = WEXITSTATUS(compile_status) == 0 ? WEXITSTATUS(system(executable_path.c_str())) : -1;
+
+    std::filesystem::remove(program_path);
+    std::filesystem::remove(executable_path);
+
+    return status;
+}
+
 TEST(ir_dump, calcul_program) {
-    ASSERT_EQ(2, getProgramResult("1 + 1"));
-    ASSERT_EQ(5, getProgramResult("(3 * 2 + 4) / 2"));
+    for (const auto &[source, result] : CALCUL_PROGRAMS) {
+        ASSERT_EQ(result, getProgramResult(source)) << source;
+    }
 }
 
 TEST(ir_dump, variable_program) {
-    ASSERT_EQ(2, getProgramResult("val foo = 2\nfoo"));
+    for (const auto &[source, result] : VARIABLE_PROGRAMS) {
+        ASSERT_EQ(result, getProgramResult(source)) << source;
+    }
 }
 
 TEST(ir_dump, pointer_program) {
-    ASSERT_EQ(3, getProgramResult("val foo = new i32(3);*foo"));
+    for (const auto &[source, result] : POINTER_PROGRAMS) {
+        ASSERT_EQ(result, getProgramResult(source)) << source;
+    }
 }
 
-TEST(ir_dump, address_program) {
-    ASSERT_EQ(4, getProgramResult("val foo = 4;val bar = &foo;*bar"));
+TEST(ir_dump, array_program) {
+    for (const auto &[source, result] : ARRAY_PROGRAMS) {
+        ASSERT_EQ(result, getProgramResult(source)) << source;
+    }
 }
 
-TEST(ir_dump, pointer_address_program) {
-    ASSERT_EQ(3, getProgramResult("val foo = new i32(3);**&*&foo"));
+TEST(ir_dump, optimized_program) {
+    ASSERT_EQ(5, getProgramResult("(3 * 2 + 4) / 2", "-O2"));
+    ASSERT_EQ(2, getProgramResult("val foo = [1, 2, 3];foo[1]", "-O2"));
+    ASSERT_EQ(3, getProgramResult("val foo = new i32(3);*foo", "-Os"));
 }
 
-TEST(ir_dump, pointer_arithmetic) {
-    ASSERT_EQ(3, getProgramResult("val foo = new i32(2);val bar = new i32(3);*(foo + 1)"));
+TEST(ir_dump, native_cpu_program) {
+    ASSERT_EQ(5, getProgramResult("(3 * 2 + 4) / 2", "--mcpu=native -O2"));
+#if defined(__x86_64__) || defined(__i386__)
+    // avx512f is an x86 feature, other backends would warn about it
+    ASSERT_EQ(6, getProgramResult("[4, 5, 6][2]", "--mcpu=native --mattr=-avx512f"));
+#endif
 }
 
-TEST(ir_dump, array_program) {
-    ASSERT_EQ(2, getProgramResult("val foo = [1, 2, 3];foo[1]"));
-    ASSERT_EQ(6, getProgramResult("[4, 5, 6][2]"));
+TEST(jit_run, run_program) {
+    ASSERT_EQ(2, getJitResult("1 + 1"));
+    ASSERT_EQ(4, getJitResult("val foo = 4;val bar = &foo;*bar"));
+    ASSERT_EQ(6, getJitResult("[4, 5, 6][2]", "-O2"));
+}
+
+TEST(emit, executable) {
+    ASSERT_EQ(2, getExecutableResult("1 + 1"));
+    ASSERT_EQ(3, getExecutableResult("val foo = new i32(3);*foo"));
 }
 
-TEST(ir_dump, multi_dim_array_program) {
-    ASSERT_EQ(5, getProgramResult("[[1, 2, 3], [4, 5, 6], [7, 8, 9]][1][1]"));
-    ASSERT_EQ(
-        1,
-        getProgramResult("[[[0, 1, 2], [3, 4, 5], [6, 7, 8]], [[9, 0, 1], [2, 3, 4], [5, 6, 7]], [[8, 9, 0], [1, 2, "
-                         "3], [4, 5, 6]]][2][1][0]")
-    );
+TEST(emit, textual_ir) {
+    const auto output_path = temporary_file("emit_test.ll");
+    const auto status      = system((FILC_BIN " --emit=ll -o " + output_path + " " FIXTURES_PATH "/valid.fil").c_str());
+    ASSERT_EQ(0, WEXITSTATUS(status));
+    ASSERT_TRUE(std::filesystem::exists(output_path));
+    std::filesystem::remove(output_path);
 }
@@ -23,6 +23,8 @@
  */
 #include "test_tools.h"
 
+#include <cstdlib>
+#include <filesystem>
 #include <memory>
 #include <stdexcept>
 
@@ -41,3 +43,20 @@ auto exec_output(const char *cmd) -> std::string {
 
     return result;
 }
+
+auto temporary_file(const std::string &name) -> std::string {
+    static const std::string directory = [] {
+        auto pattern = (std::filesystem::temp_directory_path() / "filc_e2e_XXXXXX").string();
+        if (mkdtemp(pattern.data()) == nullptr) {
+            throw std::runtime_error("mkdtemp() failed!");
+        }
+        return pattern;
+    }();
+    static const auto cleanup = std::atexit([] {
+        std::error_code ignored;
+        std::filesystem::remove_all(directory, ignored);
+    });
+    (void) cleanup;
+
+    return (std::filesystem::path(directory) / name).string();
+}
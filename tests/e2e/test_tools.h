@@ -28,6 +28,12 @@
 
 auto exec_output(const char *cmd) -> std::string;
 
+/**
+ * Path of name in a directory private to the test process, removed at exit, so that tests never write into the
+ * source tree and parallel test processes don't share files
+ */
+auto temporary_file(const std::string &name) -> std::string;
+
 #define run_with_args(args) exec_output(FILC_BIN " " args)
 
 #endif // FILC_TEST_TOOLS_H
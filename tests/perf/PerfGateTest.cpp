@@ -0,0 +1,86 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2025-Present Kevin Traini
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "bench_tools.h"
+#include "e2e_programs.h"
+#include "perf_tools.h"
+
+#include <cstdlib>
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+using namespace ::testing;
+
+// Compare each program of the corpus against tests/perf/baseline.json, metrics missing from it are not checked.
+// The committed baseline only holds ll_fallbacks, the one metric that doesn't depend on the machine.
+// Set FILC_PERF_UPDATE_BASELINE=1 (or build target perf-baseline) to record current metrics as the new baseline.
+
+namespace {
+constexpr unsigned int REPETITIONS = 5;
+
+auto checkPerformance(const std::string &program, const std::vector<std::string> &programs) -> void {
+    const auto metrics = measure(programs, REPETITIONS);
+    auto baseline      = readBaseline(PERF_BASELINE_PATH);
+
+    if (std::getenv("FILC_PERF_UPDATE_BASELINE") != nullptr) {
+        baseline[program] = metrics;
+        writeBaseline(PERF_BASELINE_PATH, baseline);
+        return;
+    }
+
+    const auto reference = baseline.find(program);
+    if (reference == baseline.end() || reference->second.find("ll_fallbacks") == reference->second.end()) {
+        FAIL() << "No baseline for " << program << ", build target perf-baseline to record one";
+    }
+
+    ASSERT_THAT(findRegressions(metrics, reference->second, PERF_THRESHOLD / 100.0), IsEmpty());
+}
+} // namespace
+
+TEST(perf, e2e) {
+    std::vector<std::string> programs;
+    for (const auto &program : allE2EPrograms()) {
+        programs.emplace_back(program.source);
+    }
+    checkPerformance("e2e", programs);
+}
+
+TEST(perf, calcul) {
+    checkPerformance("calcul", {generateCalculProgram(1024)});
+}
+
+TEST(perf, nested) {
+    checkPerformance("nested", {generateNestedProgram(256)});
+}
+
+TEST(perf, declarations) {
+    checkPerformance("declarations", {generateDeclarationProgram(1024)});
+}
+
+TEST(perf, array) {
+    checkPerformance("array", {generateArrayProgram(1024)});
+}
+
+TEST(perf, strings) {
+    checkPerformance("strings", {generateStringProgram(4096)});
+}
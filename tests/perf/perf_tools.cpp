@@ -0,0 +1,247 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2025-Present Kevin Traini
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "perf_tools.h"
+
+#include "FilLexer.h"
+#include "FilParser.h"
+#include "antlr4-runtime.h"
+#include "bench_tools.h"
+
+#include <filc/grammar/Parser.h>
+#include <filc/llvm/IRGenerator.h>
+#include <filc/utils/Diagnostics.h>
+#include <filc/utils/SourceManager.h>
+#include <filc/utils/TimeReport.h>
+#include <filc/validation/ValidationVisitor.h>
+#include <filesystem>
+#include <fstream>
+#include <regex>
+#include <sstream>
+#include <stdexcept>
+#include <sys/resource.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+namespace {
+constexpr double TIME_NOISE_MS = 0.5;
+
+auto compile(const std::string &file, Metrics &metrics) -> void {
+    filc::TimeReport report(file);
+    filc::SourceManager sources;
+    const auto program = filc::ParserProxy::parse(file, sources, &report);
+
+    filc::TimeScope validation_scope(&report, "Validation");
+    std::stringstream diagnostics_output;
+    filc::Diagnostics diagnostics(diagnostics_output);
+    filc::ValidationVisitor validation_visitor(diagnostics);
+    program->acceptVoidVisitor(&validation_visitor);
+    validation_scope.stop();
+    if (validation_visitor.hasError()) {
+        diagnostics.flush();
+        throw std::logic_error("Program is not valid: " + diagnostics_output.str());
+    }
+
+    filc::TimeScope ir_scope(&report, "IR generation");
+    filc::IRGenerator ir_generator(file, validation_visitor.getEnvironment());
+    program->acceptIRVisitor(&ir_generator);
+    ir_scope.stop();
+
+    if (ir_generator.setupTarget("", "", "", "0") != 0) {
+        throw std::logic_error("Could not set up the host target");
+    }
+    filc::TimeScope codegen_scope(&report, "Code generation");
+    const auto output_file = std::filesystem::path(file).replace_extension(".o").string();
+    if (ir_generator.toTarget(output_file, "obj") != 0) {
+        throw std::logic_error("Could not generate " + output_file);
+    }
+    codegen_scope.stop();
+
+    for (const auto &phase : report.getPhases()) {
+        const auto name = phase.name + " wall_ms";
+        const auto time = std::chrono::duration<double, std::milli>(phase.wall_time).count();
+        const auto best = metrics.find(name);
+        if (best == metrics.end() || time < best->second) {
+            metrics[name] = time;
+        }
+    }
+}
+
+auto countLLFallbacks(const std::string &content) -> double {
+    antlr4::ANTLRInputStream input(content);
+    filc::FilLexer lexer(&input);
+    antlr4::CommonTokenStream tokens(&lexer);
+    filc::FilParser parser(&tokens);
+    parser.setProfile(true);
+    parser.program();
+
+    double fallbacks = 0;
+    for (const auto &decision : parser.getParseInfo().getDecisionInfo()) {
+        fallbacks += static_cast<double>(decision.LL_Fallback);
+    }
+
+    return fallbacks;
+}
+
+auto measureInProcess(const std::vector<std::string> &programs, const unsigned int repetitions) -> Metrics {
+    Metrics total;
+    for (const auto &content : programs) {
+        const auto file = writeProgram("filc_perf_gate", content);
+        Metrics best;
+        for (unsigned int i = 0; i < repetitions; i++) {
+            compile(file, best);
+        }
+        for (const auto &[name, value] : best) {
+            total[name] += value;
+        }
+    }
+
+    rusage usage {};
+    getrusage(RUSAGE_SELF, &usage);
+    total["peak_rss_kib"] = static_cast<double>(usage.ru_maxrss);
+
+    // Profiling slows the parser down, it runs once timings and memory are known
+    total["ll_fallbacks"] = 0;
+    for (const auto &content : programs) {
+        total["ll_fallbacks"] += countLLFallbacks(content);
+    }
+
+    return total;
+}
+} // namespace
+
+auto measure(const std::vector<std::string> &programs, const unsigned int repetitions) -> Metrics {
+    int fds[2];
+    if (pipe(fds) != 0) {
+        throw std::runtime_error("pipe() failed!");
+    }
+
+    const auto pid = fork();
+    if (pid < 0) {
+        throw std::runtime_error("fork() failed!");
+    }
+    if (pid == 0) {
+        close(fds[0]);
+        std::stringstream output;
+        try {
+            for (const auto &[name, value] : measureInProcess(programs, repetitions)) {
+                output << name << '\t' << value << '\n';
+            }
+        } catch (const std::exception &e) {
+            output << "error\t" << e.what() << '\n';
+        }
+        const auto content = output.str();
+        [[maybe_unused]] const auto written = write(fds[1], content.data(), content.size());
+        close(fds[1]);
+        _exit(0);
+    }
+
+    close(fds[1]);
+    std::string content;
+    char buffer[4096];
+    ssize_t count;
+    while ((count = read(fds[0], buffer, sizeof buffer)) > 0) {
+        content.append(buffer, static_cast<size_t>(count));
+    }
+    close(fds[0]);
+    waitpid(pid, nullptr, 0);
+
+    Metrics metrics;
+    std::istringstream lines(content);
+    std::string line;
+    while (std::getline(lines, line)) {
+        const auto separator = line.find('\t');
+        const auto name      = line.substr(0, separator);
+        if (name == "error") {
+            throw std::runtime_error(line.substr(separator + 1));
+        }
+        metrics[name] = std::stod(line.substr(separator + 1));
+    }
+    if (metrics.empty()) {
+        throw std::runtime_error("Measuring process exited without any result");
+    }
+
+    return metrics;
+}
+
+auto readBaseline(const std::string &path) -> std::map<std::string, Metrics> {
+    std::ifstream file(path);
+    if (! file.is_open()) {
+        return {};
+    }
+
+    const std::regex entry_regex(
+        R"re(\{"program":\s*"([^"]*)",\s*"metric":\s*"([^"]*)",\s*"value":\s*([-0-9.e+]+)\})re"
+    );
+    std::map<std::string, Metrics> baseline;
+    std::string line;
+    while (std::getline(file, line)) {
+        std::smatch match;
+        if (std::regex_search(line, match, entry_regex)) {
+            baseline[match[1].str()][match[2].str()] = std::stod(match[3].str());
+        }
+    }
+
+    return baseline;
+}
+
+auto writeBaseline(const std::string &path, const std::map<std::string, Metrics> &baseline) -> void {
+    std::ofstream file(path);
+    file << "[\n";
+    auto first = true;
+    for (const auto &[program, metrics] : baseline) {
+        for (const auto &[name, value] : metrics) {
+            file << (first ? "" : ",\n") << R"({"program": ")" << program << R"(", "metric": ")" << name
+                 << R"(", "value": )" << value << "}";
+            first = false;
+        }
+    }
+    file << (first ? "" : "\n") << "]\n";
+}
+
+auto findRegressions(const Metrics &metrics, const Metrics &baseline, const double threshold)
+    -> std::vector<std::string> {
+    std::vector<std::string> regressions;
+    for (const auto &[name, value] : metrics) {
+        const auto reference = baseline.find(name);
+        if (reference == baseline.end()) {
+            continue;
+        }
+
+        auto limit = reference->second * (1 + threshold);
+        if (name == "ll_fallbacks") {
+            limit = reference->second;
+        } else if (name.size() > 8 && name.substr(name.size() - 8) == " wall_ms") {
+            limit += TIME_NOISE_MS;
+        }
+
+        if (value > limit) {
+            std::stringstream regression;
+            regression << name << ": " << value << " exceeds baseline " << reference->second << " (limit " << limit
+                       << ")";
+            regressions.push_back(regression.str());
+        }
+    }
+
+    return regressions;
+}
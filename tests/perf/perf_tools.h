@@ -0,0 +1,54 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2025-Present Kevin Traini
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef FILC_PERF_TOOLS_H
+#define FILC_PERF_TOOLS_H
+
+#include <map>
+#include <string>
+#include <vector>
+
+// Metrics of a program, by name: "<phase> wall_ms" for each compiler phase, "peak_rss_kib" and "ll_fallbacks"
+using Metrics = std::map<std::string, double>;
+
+/**
+ * Compile programs in a forked process, so that its peak RSS only accounts for them.
+ * Phase timings are the best of `repetitions` runs, summed over programs.
+ * ll_fallbacks counts the decisions for which ANTLR had to retry with full context prediction.
+ */
+auto measure(const std::vector<std::string> &programs, unsigned int repetitions) -> Metrics;
+
+/**
+ * Baseline is a JSON array of {"program": ..., "metric": ..., "value": ...} objects, one per line
+ */
+auto readBaseline(const std::string &path) -> std::map<std::string, Metrics>;
+
+auto writeBaseline(const std::string &path, const std::map<std::string, Metrics> &baseline) -> void;
+
+/**
+ * Describe each metric exceeding its baseline by more than threshold (0.25 for 25%).
+ * Any new LL fallback is a regression, timings below a fraction of millisecond are considered as noise.
+ */
+auto findRegressions(const Metrics &metrics, const Metrics &baseline, double threshold) -> std::vector<std::string>;
+
+#endif // FILC_PERF_TOOLS_H
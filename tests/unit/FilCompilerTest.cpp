@@ -24,12 +24,14 @@
 #include "test_tools.h"
 
 #include <filc/filc.h>
+#include <filesystem>
+#include <fstream>
 #include <gtest/gtest.h>
 #include <sstream>
+#include <vector>
 
 TEST(FilCompiler, run) {
-    auto compiler
-        = filc::FilCompiler(filc::OptionsParser(), filc::DumpVisitor(std::cout), filc::ValidationVisitor(std::cout));
+    auto compiler = filc::FilCompiler(filc::OptionsParser(), std::cout);
 
     SCOPED_TRACE("No argument");
     ASSERT_EQ(0, compiler.run(1, toStringArray({"filc"}).data()));
@@ -43,7 +45,7 @@ TEST(FilCompiler, run) {
 
 TEST(FilCompiler, dumpAST) {
     std::stringstream ss;
-    auto compiler = filc::FilCompiler(filc::OptionsParser(), filc::DumpVisitor(ss), filc::ValidationVisitor(std::cout));
+    auto compiler = filc::FilCompiler(filc::OptionsParser(), ss);
     ASSERT_EQ(0, compiler.run(3, toStringArray({"filc", "--dump=ast", FIXTURES_PATH "/sample.fil"}).data()));
     std::string result(std::istreambuf_iterator<char>(ss), {});
     ASSERT_STREQ(
@@ -76,8 +78,185 @@ TEST(FilCompiler, dumpAST) {
     );
 }
 
+TEST(FilCompiler, syntaxErrorJson) {
+    std::stringstream ss;
+    auto compiler = filc::FilCompiler(filc::OptionsParser(), ss);
+    ASSERT_EQ(
+        1,
+        compiler.run(3, toStringArray({"filc", "--diagnostics-format=json", FIXTURES_PATH "/syntax_error.fil"}).data())
+    );
+    ASSERT_NE(std::string::npos, ss.str().find(R"("severity":"error","code":"syntax-error")"));
+}
+
+TEST(FilCompiler, baseDirectory) {
+    std::stringstream out;
+    std::stringstream err;
+    auto compiler = filc::FilCompiler(filc::OptionsParser(), out, err, FIXTURES_PATH);
+    ASSERT_EQ(0, compiler.run(3, toStringArray({"filc", "--dump=ast", "valid.fil"}).data()));
+    ASSERT_STREQ("=== Begin AST dump ===\n[Integer:0]\n=== End AST dump ===\n", out.str().c_str());
+    ASSERT_TRUE(err.str().empty());
+
+    auto missing_compiler = filc::FilCompiler(filc::OptionsParser(), out, err, FIXTURES_PATH);
+    ASSERT_EQ(1, missing_compiler.run(2, toStringArray({"filc", "missing.fil"}).data()));
+    ASSERT_NE(std::string::npos, err.str().find(FIXTURES_PATH "/missing.fil"));
+}
+
 TEST(FilCompiler, fullRun) {
     std::stringstream ss;
-    auto compiler = filc::FilCompiler(filc::OptionsParser(), filc::DumpVisitor(ss), filc::ValidationVisitor(std::cout));
+    auto compiler = filc::FilCompiler(filc::OptionsParser(), ss);
     ASSERT_EQ(0, compiler.run(2, toStringArray({"filc", FIXTURES_PATH "/valid.fil"}).data()));
 }
+
+TEST(FilCompiler, multipleFiles) {
+    const auto directory = std::filesystem::temp_directory_path() / "filc_multiple_files";
+    std::filesystem::create_directories(directory);
+    std::vector<std::string> arguments = {"filc", "--emit=ll", "-j", "2"};
+    for (const auto &name : {"a", "b", "c"}) {
+        const auto file = directory / (std::string(name) + ".fil");
+        std::filesystem::copy_file(FIXTURES_PATH "/valid.fil", file, std::filesystem::copy_options::overwrite_existing);
+        arguments.push_back(file.string());
+    }
+
+    std::stringstream ss;
+    auto compiler = filc::FilCompiler(filc::OptionsParser(), ss);
+    ASSERT_EQ(0, compiler.run(static_cast<int>(arguments.size()), toStringArray(arguments).data()));
+    ASSERT_TRUE(std::filesystem::exists(directory / "a.ll"));
+    ASSERT_TRUE(std::filesystem::exists(directory / "b.ll"));
+    ASSERT_TRUE(std::filesystem::exists(directory / "c.ll"));
+
+    SCOPED_TRACE("-o with several files");
+    arguments.insert(arguments.begin() + 1, {"-o", (directory / "out.ll").string()});
+    std::stringstream err;
+    auto output_compiler = filc::FilCompiler(filc::OptionsParser(), ss, err);
+    ASSERT_EQ(1, output_compiler.run(static_cast<int>(arguments.size()), toStringArray(arguments).data()));
+    ASSERT_STREQ("-o can only be used with a single input file", err.str().c_str());
+    ASSERT_FALSE(std::filesystem::exists(directory / "out.ll"));
+
+    std::filesystem::remove_all(directory);
+}
+
+TEST(FilCompiler, cache) {
+    const auto directory = std::filesystem::temp_directory_path() / "filc_cache";
+    std::filesystem::remove_all(directory);
+    const auto cache_option = "--cache-dir=" + (directory / "cache").string();
+    const auto output       = (directory / "valid.ll").string();
+    const std::vector<std::string> arguments
+        = {"filc", cache_option, "--emit=ll", "-o", output, FIXTURES_PATH "/valid.fil"};
+
+    for (int i = 0; i < 2; i++) {
+        std::stringstream ss;
+        auto compiler = filc::FilCompiler(filc::OptionsParser(), ss);
+        ASSERT_EQ(0, compiler.run(static_cast<int>(arguments.size()), toStringArray(arguments).data()));
+        ASSERT_TRUE(std::filesystem::exists(output));
+        std::filesystem::remove(output);
+    }
+
+    std::stringstream ss;
+    auto compiler = filc::FilCompiler(filc::OptionsParser(), ss);
+    ASSERT_EQ(0, compiler.run(3, toStringArray({"filc", cache_option, "--cache-stats"}).data()));
+    const auto result = ss.str();
+    ASSERT_NE(std::string::npos, result.find("Hits: 1\n"));
+    ASSERT_NE(std::string::npos, result.find("Misses: 1\n"));
+
+    std::filesystem::remove_all(directory);
+}
+
+TEST(FilCompiler, cacheModuleName) {
+    const auto directory = std::filesystem::temp_directory_path() / "filc_cache_module_name";
+    std::filesystem::remove_all(directory);
+    std::filesystem::create_directories(directory);
+    const auto cache_option = "--cache-dir=" + (directory / "cache").string();
+    for (const auto &name : {"a", "b"}) {
+        const auto input  = (directory / (std::string(name) + ".fil")).string();
+        const auto output = (directory / (std::string(name) + ".ll")).string();
+        std::filesystem::copy_file(FIXTURES_PATH "/valid.fil", input);
+        std::stringstream ss;
+        auto compiler = filc::FilCompiler(filc::OptionsParser(), ss);
+        const std::vector<std::string> arguments = {"filc", cache_option, "--emit=ll", "-o", output, input};
+        ASSERT_EQ(0, compiler.run(static_cast<int>(arguments.size()), toStringArray(arguments).data()));
+    }
+
+    std::ifstream output(directory / "b.ll");
+    const std::string ir((std::istreambuf_iterator<char>(output)), std::istreambuf_iterator<char>());
+    ASSERT_NE(std::string::npos, ir.find((directory / "b.fil").string()));
+    ASSERT_EQ(std::string::npos, ir.find((directory / "a.fil").string()));
+
+    std::filesystem::remove_all(directory);
+}
+
+TEST(FilCompiler, cacheWithDiagnostics) {
+    const auto directory = std::filesystem::temp_directory_path() / "filc_cache_diagnostics";
+    std::filesystem::remove_all(directory);
+    std::filesystem::create_directories(directory);
+    const auto cache_option = "--cache-dir=" + (directory / "cache").string();
+    const auto output       = (directory / "warning.ll").string();
+    const auto input        = (directory / "warning.fil").string();
+    std::ofstream(input) << "1\n0";
+    const auto statistics = [&cache_option] {
+        std::stringstream ss;
+        auto compiler = filc::FilCompiler(filc::OptionsParser(), ss);
+        compiler.run(3, toStringArray({"filc", cache_option, "--cache-stats"}).data());
+        return ss.str();
+    };
+
+    for (int i = 0; i < 2; i++) {
+        std::stringstream ss;
+        auto compiler = filc::FilCompiler(filc::OptionsParser(), ss);
+        const std::vector<std::string> arguments = {"filc", cache_option, "--emit=ll", "-o", output, input};
+        ASSERT_EQ(0, compiler.run(static_cast<int>(arguments.size()), toStringArray(arguments).data()));
+        ASSERT_NE(std::string::npos, ss.str().find("Integer value not used"));
+        ASSERT_NE(std::string::npos, ss.str().find(input + ":1:0"));
+        ASSERT_TRUE(std::filesystem::exists(output));
+    }
+    ASSERT_NE(std::string::npos, statistics().find("Hits: 1\n"));
+
+    SCOPED_TRACE("Limit applied on replay");
+    std::stringstream limited;
+    auto limited_compiler = filc::FilCompiler(filc::OptionsParser(), limited);
+    const std::vector<std::string> limited_arguments
+        = {"filc", cache_option, "--diagnostics-format=json", "--max-diagnostics=1", "--emit=ll", "-o", output, input};
+    ASSERT_EQ(
+        0, limited_compiler.run(static_cast<int>(limited_arguments.size()), toStringArray(limited_arguments).data())
+    );
+    ASSERT_NE(std::string::npos, limited.str().find(R"("code":"max-diagnostics")"));
+
+    SCOPED_TRACE("-Werror applied on replay");
+    std::filesystem::remove(output);
+    std::stringstream ss;
+    auto compiler = filc::FilCompiler(filc::OptionsParser(), ss);
+    const std::vector<std::string> arguments = {"filc", cache_option, "-Werror", "--emit=ll", "-o", output, input};
+    ASSERT_EQ(1, compiler.run(static_cast<int>(arguments.size()), toStringArray(arguments).data()));
+    ASSERT_FALSE(std::filesystem::exists(output));
+
+    const auto result = statistics();
+    ASSERT_NE(std::string::npos, result.find("Hits: 3\n"));
+    ASSERT_NE(std::string::npos, result.find("Misses: 1\n"));
+
+    std::filesystem::remove_all(directory);
+}
+
+TEST(FilCompiler, cacheWarningOptions) {
+    const auto directory = std::filesystem::temp_directory_path() / "filc_cache_warning_options";
+    std::filesystem::remove_all(directory);
+    std::filesystem::create_directories(directory);
+    const auto cache_option = "--cache-dir=" + (directory / "cache").string();
+    const auto output       = (directory / "warning.ll").string();
+    const auto input        = (directory / "warning.fil").string();
+    std::ofstream(input) << "1\n0";
+
+    std::stringstream silent;
+    auto silent_compiler = filc::FilCompiler(filc::OptionsParser(), silent);
+    const std::vector<std::string> silent_arguments = {"filc", cache_option, "-w", "--emit=ll", "-o", output, input};
+    ASSERT_EQ(
+        0, silent_compiler.run(static_cast<int>(silent_arguments.size()), toStringArray(silent_arguments).data())
+    );
+    ASSERT_TRUE(silent.str().empty());
+
+    std::stringstream ss;
+    auto compiler = filc::FilCompiler(filc::OptionsParser(), ss);
+    const std::vector<std::string> arguments = {"filc", cache_option, "--emit=ll", "-o", output, input};
+    ASSERT_EQ(0, compiler.run(static_cast<int>(arguments.size()), toStringArray(arguments).data()));
+    ASSERT_NE(std::string::npos, ss.str().find("Integer value not used"));
+
+    std::filesystem::remove_all(directory);
+}
@@ -0,0 +1,130 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2025-Present Kevin Traini
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include <chrono>
+#include <filc/cache/ObjectCache.h>
+#include <filesystem>
+#include <fstream>
+#include <gtest/gtest.h>
+#include <sstream>
+#include <string>
+
+namespace {
+class ObjectCacheTest : public testing::Test {
+  protected:
+    std::filesystem::path _directory;
+
+    auto SetUp() -> void override {
+        _directory = std::filesystem::temp_directory_path() / "filc_object_cache_test";
+        std::filesystem::remove_all(_directory);
+        std::filesystem::create_directories(_directory);
+    }
+
+    auto TearDown() -> void override {
+        std::filesystem::remove_all(_directory);
+    }
+
+    auto writeFile(const std::string &name, const std::string &content) const -> std::string {
+        const auto file = (_directory / name).string();
+        std::ofstream(file) << content;
+        return file;
+    }
+
+    static auto readFile(const std::string &file) -> std::string {
+        std::ifstream in(file);
+        return {std::istreambuf_iterator<char>(in), {}};
+    }
+};
+} // namespace
+
+TEST_F(ObjectCacheTest, computeKey) {
+    const auto key = filc::ObjectCache::computeKey("1 + 1", {"0.2.0", "x86_64-pc-linux-gnu", "2"});
+    ASSERT_EQ(64, key.size());
+    ASSERT_EQ(key, filc::ObjectCache::computeKey("1 + 1", {"0.2.0", "x86_64-pc-linux-gnu", "2"}));
+    ASSERT_NE(key, filc::ObjectCache::computeKey("1 + 2", {"0.2.0", "x86_64-pc-linux-gnu", "2"}));
+    ASSERT_NE(key, filc::ObjectCache::computeKey("1 + 1", {"0.2.0", "x86_64-pc-linux-gnu", "3"}));
+    ASSERT_NE(filc::ObjectCache::computeKey("", {"ab", "c"}), filc::ObjectCache::computeKey("", {"a", "bc"}));
+}
+
+TEST_F(ObjectCacheTest, fetchAndStore) {
+    filc::ObjectCache cache((_directory / "cache").string(), 1024 * 1024);
+    const auto output = (_directory / "output.o").string();
+    std::string diagnostics;
+    ASSERT_FALSE(cache.fetch("key", output, diagnostics));
+    ASSERT_FALSE(std::filesystem::exists(output));
+
+    cache.store("key", writeFile("compiled.o", "object content"), "diagnostics content");
+    ASSERT_TRUE(cache.fetch("key", output, diagnostics));
+    ASSERT_EQ("object content", readFile(output));
+    ASSERT_EQ("diagnostics content", diagnostics);
+    ASSERT_EQ(1, cache.getHits());
+    ASSERT_EQ(1, cache.getMisses());
+}
+
+TEST_F(ObjectCacheTest, fetchIncompleteEntry) {
+    filc::ObjectCache cache((_directory / "cache").string(), 1024 * 1024);
+    const auto output = (_directory / "output.o").string();
+    cache.store("key", writeFile("compiled.o", "object content"), "");
+    std::filesystem::remove(_directory / "cache" / "objects" / "key.diagnostics");
+    std::string diagnostics;
+    ASSERT_FALSE(cache.fetch("key", output, diagnostics));
+}
+
+TEST_F(ObjectCacheTest, statistics) {
+    const auto directory = (_directory / "cache").string();
+    {
+        filc::ObjectCache cache(directory, 1024);
+        cache.store("key", writeFile("compiled.o", "object content"), "");
+        std::string diagnostics;
+        ASSERT_TRUE(cache.fetch("key", (_directory / "output.o").string(), diagnostics));
+        ASSERT_FALSE(cache.fetch("other", (_directory / "output.o").string(), diagnostics));
+        cache.flush();
+        ASSERT_EQ(0, cache.getHits());
+    }
+
+    filc::ObjectCache cache(directory, 1024);
+    std::stringstream out;
+    cache.showStatistics(out);
+    const auto result = out.str();
+    ASSERT_NE(std::string::npos, result.find("Entries: 1\n"));
+    ASSERT_NE(std::string::npos, result.find("Hits: 1\n"));
+    ASSERT_NE(std::string::npos, result.find("Misses: 1\n"));
+}
+
+TEST_F(ObjectCacheTest, evictLeastRecentlyUsed) {
+    filc::ObjectCache cache((_directory / "cache").string(), 20);
+    const auto output = (_directory / "output.o").string();
+    std::string diagnostics;
+    cache.store("first", writeFile("first.o", "0123456789"), "");
+    cache.store("second", writeFile("second.o", "0123456789"), "");
+    const auto an_hour_ago = std::filesystem::file_time_type::clock::now() - std::chrono::hours(1);
+    std::filesystem::last_write_time(_directory / "cache" / "objects" / "first", an_hour_ago);
+    ASSERT_TRUE(cache.fetch("first", output, diagnostics));
+    cache.store("third", writeFile("third.o", "0123456789"), "");
+    cache.flush();
+
+    ASSERT_TRUE(cache.fetch("first", output, diagnostics));
+    ASSERT_FALSE(cache.fetch("second", output, diagnostics));
+    ASSERT_FALSE(std::filesystem::exists(_directory / "cache" / "objects" / "second.diagnostics"));
+    ASSERT_TRUE(cache.fetch("third", output, diagnostics));
+}
@@ -0,0 +1,48 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2025-Present Kevin Traini
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "test_tools.h"
+
+#include <filc/grammar/Dispatch.h>
+#include <gtest/gtest.h>
+
+TEST(Dispatch, kind) {
+    filc::IntegerLiteral left(1);
+    filc::Identifier right("a");
+    filc::BinaryCalcul calcul(&left, filc::BinaryOperator::PLUS, &right);
+    ASSERT_EQ(filc::ExpressionKind::INTEGER_LITERAL, left.getKind());
+    ASSERT_EQ(filc::ExpressionKind::IDENTIFIER, right.getKind());
+    ASSERT_EQ(filc::ExpressionKind::BINARY_CALCUL, calcul.getKind());
+}
+
+TEST(Dispatch, sameAsAccept) {
+    const auto program
+        = parseString("val a = [1, 2][0] + 3\n&a\n*new int(2)\n\"foo\"\nvar b: f32 = 3.4\nb *= 2.0\ntrue");
+    for (const auto expression : program->getExpressions()) {
+        PrinterVisitor accept_visitor;
+        expression->acceptVoidVisitor(&accept_visitor);
+        PrinterVisitor dispatch_visitor;
+        filc::dispatch(&dispatch_visitor, expression);
+        ASSERT_STREQ(accept_visitor.getResult().c_str(), dispatch_visitor.getResult().c_str());
+    }
+}
@@ -30,41 +30,44 @@
 #include <filc/grammar/variable/Variable.h>
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
+#include <sstream>
 
 using namespace ::testing;
 
 TEST(Parser, nonExistingFile) {
-    ASSERT_THROW(filc::ParserProxy::parse("non-existing-file"), std::logic_error);
+    filc::SourceManager sources;
+    ASSERT_THROW(filc::ParserProxy::parse("non-existing-file", sources), std::logic_error);
 }
 
 TEST(Parser, parseSample) {
-    const auto program = filc::ParserProxy::parse(FIXTURES_PATH "/sample.fil");
+    filc::SourceManager sources;
+    const auto program = filc::ParserProxy::parse(FIXTURES_PATH "/sample.fil", sources);
     ASSERT_THAT(program->getExpressions(), SizeIs(11));
 
     {
         SCOPED_TRACE("true");
-        const auto expression = std::dynamic_pointer_cast<filc::BooleanLiteral>(program->getExpressions()[0]);
+        const auto expression = dynamic_cast<filc::BooleanLiteral *>(program->getExpressions()[0]);
         ASSERT_NE(nullptr, expression);
         ASSERT_TRUE(expression->getValue());
     }
 
     {
         SCOPED_TRACE("6.82");
-        const auto expression = std::dynamic_pointer_cast<filc::FloatLiteral>(program->getExpressions()[1]);
+        const auto expression = dynamic_cast<filc::FloatLiteral *>(program->getExpressions()[1]);
         ASSERT_NE(nullptr, expression);
         ASSERT_EQ(6.82, expression->getValue());
     }
 
     {
         SCOPED_TRACE("\"hEllO\"");
-        const auto expression = std::dynamic_pointer_cast<filc::StringLiteral>(program->getExpressions()[2]);
+        const auto expression = dynamic_cast<filc::StringLiteral *>(program->getExpressions()[2]);
         ASSERT_NE(nullptr, expression);
         ASSERT_STREQ("hEllO", expression->getValue().c_str());
     }
 
     {
         SCOPED_TRACE("val some_constant_73");
-        const auto expression = std::dynamic_pointer_cast<filc::VariableDeclaration>(program->getExpressions()[3]);
+        const auto expression = dynamic_cast<filc::VariableDeclaration *>(program->getExpressions()[3]);
         ASSERT_NE(nullptr, expression);
         ASSERT_TRUE(expression->isConstant());
         ASSERT_STREQ("some_constant_73", expression->getName().c_str());
@@ -74,7 +77,7 @@ TEST(Parser, parseSample) {
 
     {
         SCOPED_TRACE("var myAweSOMeVariable: i32");
-        const auto expression = std::dynamic_pointer_cast<filc::VariableDeclaration>(program->getExpressions()[4]);
+        const auto expression = dynamic_cast<filc::VariableDeclaration *>(program->getExpressions()[4]);
         ASSERT_NE(nullptr, expression);
         ASSERT_FALSE(expression->isConstant());
         ASSERT_STREQ("myAweSOMeVariable", expression->getName().c_str());
@@ -84,27 +87,27 @@ TEST(Parser, parseSample) {
 
     {
         SCOPED_TRACE("val anotherConst = 73");
-        const auto expression = std::dynamic_pointer_cast<filc::VariableDeclaration>(program->getExpressions()[5]);
+        const auto expression = dynamic_cast<filc::VariableDeclaration *>(program->getExpressions()[5]);
         ASSERT_NE(nullptr, expression);
         ASSERT_TRUE(expression->isConstant());
         ASSERT_STREQ("anotherConst", expression->getName().c_str());
         ASSERT_STREQ("", expression->getTypeName().c_str());
-        ASSERT_EQ(73, std::dynamic_pointer_cast<filc::IntegerLiteral>(expression->getValue())->getValue());
+        ASSERT_EQ(73, dynamic_cast<filc::IntegerLiteral *>(expression->getValue())->getValue());
     }
 
     {
         SCOPED_TRACE("var my_var: char = 'c'");
-        const auto expression = std::dynamic_pointer_cast<filc::VariableDeclaration>(program->getExpressions()[6]);
+        const auto expression = dynamic_cast<filc::VariableDeclaration *>(program->getExpressions()[6]);
         ASSERT_NE(nullptr, expression);
         ASSERT_FALSE(expression->isConstant());
         ASSERT_STREQ("my_var", expression->getName().c_str());
         ASSERT_STREQ("char", expression->getTypeName().c_str());
-        ASSERT_EQ('c', std::dynamic_pointer_cast<filc::CharacterLiteral>(expression->getValue())->getValue());
+        ASSERT_EQ('c', dynamic_cast<filc::CharacterLiteral *>(expression->getValue())->getValue());
     }
 
     {
         SCOPED_TRACE("_some_varWhichUses_Some_CHARACTERS");
-        const auto expression = std::dynamic_pointer_cast<filc::Identifier>(program->getExpressions()[7]);
+        const auto expression = dynamic_cast<filc::Identifier *>(program->getExpressions()[7]);
         ASSERT_NE(nullptr, expression);
         ASSERT_STREQ("_some_varWhichUses_Some_CHARACTERS", expression->getName().c_str());
     }
@@ -133,3 +136,36 @@ TEST(Parser, parseSample) {
         ASSERT_STREQ("my_var = (my_var + 2)", visitor.getResult().c_str());
     }
 }
+
+TEST(Parser, parseSampleWithoutFullContext) {
+    filc::SourceManager sources;
+    const auto full_context_parses = filc::ParserProxy::getFullContextParseCount();
+    filc::TimeReport report("sample.fil");
+    const auto program = filc::ParserProxy::parse(FIXTURES_PATH "/sample.fil", sources, &report);
+    ASSERT_THAT(program->getExpressions(), SizeIs(11));
+    ASSERT_EQ(full_context_parses, filc::ParserProxy::getFullContextParseCount());
+    ASSERT_THAT(report.getCounters(), Contains(Pair("Full context parses", 0)));
+}
+
+TEST(Parser, parseSyntaxErrorWithFullContext) {
+    filc::SourceManager sources;
+    const auto full_context_parses = filc::ParserProxy::getFullContextParseCount();
+    const auto program = filc::ParserProxy::parse(FIXTURES_PATH "/syntax_error.fil", sources);
+    ASSERT_THAT(program->getExpressions(), SizeIs(1));
+    ASSERT_EQ(full_context_parses + 1, filc::ParserProxy::getFullContextParseCount());
+}
+
+TEST(Parser, syntaxErrorDiagnostics) {
+    filc::SourceManager sources;
+    std::stringstream out;
+    filc::Diagnostics diagnostics(out);
+    filc::ParserProxy::parse(FIXTURES_PATH "/syntax_error.fil", sources, nullptr, &diagnostics);
+    ASSERT_TRUE(diagnostics.hasError());
+    ASSERT_THAT(diagnostics.getPending(), SizeIs(1));
+    const auto &diagnostic = diagnostics.getPending().front();
+    ASSERT_EQ(filc::Severity::ERROR, diagnostic.severity);
+    ASSERT_EQ("syntax-error", diagnostic.code);
+    ASSERT_EQ(std::make_pair(1U, 2U), diagnostic.position.getStartPosition());
+    ASSERT_THAT(diagnostic.position.getFilename(), EndsWith("syntax_error.fil"));
+    ASSERT_TRUE(out.str().empty());
+}
@@ -0,0 +1,60 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2025-Present Kevin Traini
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include <filc/grammar/Parser.h>
+#include <filc/grammar/SourceStream.h>
+#include <filc/grammar/expression/Expression.h>
+#include <filc/grammar/program/Program.h>
+#include <gtest/gtest.h>
+
+TEST(SourceStream, read) {
+    const filc::SourceBuffer source("<memory>", "val é = 2");
+    filc::SourceStream stream(&source);
+    ASSERT_EQ("<memory>", stream.getSourceName());
+    ASSERT_EQ(10, stream.size());
+    ASSERT_EQ('v', stream.LA(1));
+    ASSERT_EQ('a', stream.LA(2));
+    ASSERT_EQ(antlr4::IntStream::EOF, stream.LA(-1));
+
+    stream.consume();
+    ASSERT_EQ(1, stream.index());
+    ASSERT_EQ('v', stream.LA(-1));
+    ASSERT_EQ(0xC3, stream.LA(4)); // First byte of é
+
+    stream.seek(9);
+    ASSERT_EQ('2', stream.LA(1));
+    stream.consume();
+    ASSERT_EQ(antlr4::IntStream::EOF, stream.LA(1));
+    ASSERT_THROW(stream.consume(), antlr4::IllegalStateException);
+
+    ASSERT_EQ("val é", stream.getText(antlr4::misc::Interval(0, 5)));
+    ASSERT_EQ("2", stream.getText(antlr4::misc::Interval(9, 20)));
+}
+
+TEST(SourceStream, parserPositions) {
+    filc::SourceManager sources;
+    const auto program = filc::ParserProxy::parse(FIXTURES_PATH "/sample.fil", sources);
+    ASSERT_EQ(sources.find(FIXTURES_PATH "/sample.fil"), program->getSource());
+    const auto &position = program->getExpressions()[0]->getPosition();
+    ASSERT_EQ(std::vector<std::string>({"true"}), position.getContent());
+}
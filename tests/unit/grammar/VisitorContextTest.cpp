@@ -27,90 +27,53 @@
 
 using namespace ::testing;
 
-TEST(VisitorContext, stack_unstack) {
-    filc::VisitorContext context;
-    context.set("key", 3);
-    ASSERT_TRUE(context.has("key"));
-    context.stack();
-    ASSERT_FALSE(context.has("key"));
-    context.unstack();
-    ASSERT_TRUE(context.has("key"));
-    ASSERT_EQ(3, context.get<int>("key"));
-}
-
-TEST(VisitorContext, get_non_existing) {
-    const filc::VisitorContext context;
-    ASSERT_FALSE(context.has("non-existing"));
-    ASSERT_THROW(context.get<int>("non-existing"), std::logic_error);
-}
-
-TEST(VisitorContext, get_set_scalar) {
-    filc::VisitorContext context;
-    context.set("int_value", 2);
-    ASSERT_TRUE(context.has("int_value"));
-    ASSERT_EQ(2, context.get<int>("int_value"));
-}
-
-TEST(VisitorContext, get_set_string) {
-    filc::VisitorContext context;
-    context.set("string_value", std::string("Hello"));
-    ASSERT_TRUE(context.has("string_value"));
-    ASSERT_STREQ("Hello", context.get<std::string>("string_value").c_str());
-}
-
 typedef struct {
-    int _a;
+    int _a = 0;
     std::string _b;
-    char _c[5];
-} SomeStructure;
+    bool _c = false;
+} SomeFrame;
 
-TEST(VisitorContext, get_set_structure) {
-    filc::VisitorContext context;
-    SomeStructure value = {
-      2, "Hello World", {'a', 'b', 'c', 'd', 'e'}
-    };
-    context.set("struct_value", value);
-    ASSERT_TRUE(context.has("struct_value"));
-    const auto [a, b, c] = context.get<SomeStructure>("struct_value");
-    ASSERT_EQ(2, a);
-    ASSERT_STREQ("Hello World", b.c_str());
-    ASSERT_THAT(c, ElementsAre('a', 'b', 'c', 'd', 'e'));
+TEST(VisitorContext, constructor) {
+    const filc::VisitorContext<SomeFrame> context;
+    ASSERT_EQ(1, context.depth());
+    ASSERT_EQ(0, context.top()._a);
+    ASSERT_STREQ("", context.top()._b.c_str());
+    ASSERT_FALSE(context.top()._c);
 }
 
-class SomeClass {
-  public:
-    SomeClass(): _a(12), _b("foo") {}
-
-    [[nodiscard]] auto equals(const SomeClass &other) const -> bool {
-        return _a == other._a && _b == other._b;
-    }
+TEST(VisitorContext, stack_unstack) {
+    filc::VisitorContext<SomeFrame> context;
+    context.top()._a = 3;
+    context.stack();
+    ASSERT_EQ(2, context.depth());
+    ASSERT_EQ(0, context.top()._a);
+    context.unstack();
+    ASSERT_EQ(1, context.depth());
+    ASSERT_EQ(3, context.top()._a);
+}
 
-  private:
-    int _a;
-    std::string _b;
-};
+TEST(VisitorContext, stack_reset_frame) {
+    filc::VisitorContext<SomeFrame> context;
+    auto &frame = context.stack();
+    frame._b    = "Hello";
+    frame._c    = true;
+    context.unstack();
+    const auto &new_frame = context.stack();
+    ASSERT_STREQ("", new_frame._b.c_str());
+    ASSERT_FALSE(new_frame._c);
+}
 
-TEST(VisitorContext, get_set_object) {
-    filc::VisitorContext context;
-    SomeClass value;
-    context.set("object_value", value);
-    ASSERT_TRUE(context.has("object_value"));
-    ASSERT_TRUE(value.equals(context.get<SomeClass>("object_value")));
+TEST(VisitorContext, unstack_last) {
+    filc::VisitorContext<SomeFrame> context;
+    context.top()._a = 2;
+    context.unstack();
+    ASSERT_EQ(1, context.depth());
+    ASSERT_EQ(2, context.top()._a);
 }
 
 TEST(VisitorContext, clear) {
-    filc::VisitorContext context;
-    context.set("key", "value");
-    ASSERT_TRUE(context.has("key"));
+    filc::VisitorContext<SomeFrame> context;
+    context.top()._b = "value";
     context.clear();
-    ASSERT_FALSE(context.has("key"));
-}
-
-TEST(VisitorContext, unset) {
-    filc::VisitorContext context;
-    ASSERT_FALSE(context.has("value"));
-    context.set("value", true);
-    ASSERT_TRUE(context.has("value"));
-    context.unset("value");
-    ASSERT_FALSE(context.has("value"));
+    ASSERT_STREQ("", context.top()._b.c_str());
 }
@@ -34,9 +34,9 @@ TEST(ArrayAccess, parsing) {
     const auto program     = parseString("foo[12]");
     const auto expressions = program->getExpressions();
     ASSERT_THAT(expressions, SizeIs(1));
-    const auto array_access = std::dynamic_pointer_cast<filc::ArrayAccess>(expressions[0]);
+    const auto array_access = dynamic_cast<filc::ArrayAccess *>(expressions[0]);
     ASSERT_NE(nullptr, array_access);
-    const auto identifier = std::dynamic_pointer_cast<filc::Identifier>(array_access->getArray());
+    const auto identifier = dynamic_cast<filc::Identifier *>(array_access->getArray());
     ASSERT_STREQ("foo", identifier->getName().c_str());
     ASSERT_EQ(12, array_access->getIndex());
 }
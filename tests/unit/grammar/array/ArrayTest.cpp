@@ -34,7 +34,7 @@ TEST(Array, parsingEmpty) {
     const auto program     = parseString("[]");
     const auto expressions = program->getExpressions();
     ASSERT_THAT(expressions, SizeIs(1));
-    const auto array = std::dynamic_pointer_cast<filc::Array>(expressions[0]);
+    const auto array = dynamic_cast<filc::Array *>(expressions[0]);
     ASSERT_NE(nullptr, array);
     ASSERT_EQ(0, array->getSize());
     ASSERT_THAT(array->getValues(), IsEmpty());
@@ -44,13 +44,33 @@ TEST(Array, parsingSimple) {
     const auto program     = parseString("[1, 2, 3]");
     const auto expressions = program->getExpressions();
     ASSERT_THAT(expressions, SizeIs(1));
-    const auto array = std::dynamic_pointer_cast<filc::Array>(expressions[0]);
+    const auto array = dynamic_cast<filc::Array *>(expressions[0]);
     ASSERT_NE(nullptr, array);
     ASSERT_EQ(3, array->getSize());
     const auto values = array->getValues();
     for (unsigned int i = 0; i < array->getSize(); i++) {
-        const auto value = std::dynamic_pointer_cast<filc::IntegerLiteral>(values[i]);
+        const auto value = dynamic_cast<filc::IntegerLiteral *>(values[i]);
         ASSERT_NE(nullptr, value);
         ASSERT_EQ(i + 1, value->getValue());
     }
 }
+
+TEST(Array, parsingLarge) {
+    std::string content = "[0";
+    for (unsigned int i = 1; i < 200000; i++) {
+        content += ", " + std::to_string(i);
+    }
+    content += "]";
+
+    const auto program = parseString(content);
+    ASSERT_THAT(program->getExpressions(), SizeIs(1));
+    const auto array = dynamic_cast<filc::Array *>(program->getExpressions()[0]);
+    ASSERT_NE(nullptr, array);
+    ASSERT_EQ(200000, array->getSize());
+    const auto values = array->getValues();
+    for (const auto index : {0U, 1U, 99999U, 199999U}) {
+        const auto value = dynamic_cast<filc::IntegerLiteral *>(values[index]);
+        ASSERT_NE(nullptr, value);
+        ASSERT_EQ(index, value->getValue());
+    }
+}
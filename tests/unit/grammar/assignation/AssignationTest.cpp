@@ -35,10 +35,10 @@ TEST(Assignation, parsingSimple) {
     const auto program     = parseString("foo = \"bar\"");
     const auto expressions = program->getExpressions();
     ASSERT_THAT(expressions, SizeIs(1));
-    const auto assignation = std::dynamic_pointer_cast<filc::Assignation>(expressions[0]);
+    const auto assignation = dynamic_cast<filc::Assignation *>(expressions[0]);
     ASSERT_NE(nullptr, assignation);
     ASSERT_STREQ("foo", assignation->getIdentifier().c_str());
-    const auto value = std::dynamic_pointer_cast<filc::StringLiteral>(assignation->getValue());
+    const auto value = dynamic_cast<filc::StringLiteral *>(assignation->getValue());
     ASSERT_NE(nullptr, value);
     ASSERT_STREQ("bar", value->getValue().c_str());
 }
@@ -47,10 +47,10 @@ TEST(Assignation, parsingCalcul) {
     const auto program     = parseString("bar ||= true");
     const auto expressions = program->getExpressions();
     ASSERT_THAT(expressions, SizeIs(1));
-    const auto assignation = std::dynamic_pointer_cast<filc::Assignation>(expressions[0]);
+    const auto assignation = dynamic_cast<filc::Assignation *>(expressions[0]);
     ASSERT_NE(nullptr, assignation);
     ASSERT_STREQ("bar", assignation->getIdentifier().c_str());
-    const auto value = std::dynamic_pointer_cast<filc::BinaryCalcul>(assignation->getValue());
+    const auto value = dynamic_cast<filc::BinaryCalcul *>(assignation->getValue());
     ASSERT_NE(nullptr, value);
     PrinterVisitor visitor;
     value->acceptVoidVisitor(&visitor);
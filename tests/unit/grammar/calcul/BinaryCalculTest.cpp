@@ -34,15 +34,15 @@ TEST(BinaryCalcul, parsingAddition) {
     const auto program     = parseString("1 + 2");
     const auto expressions = program->getExpressions();
     ASSERT_THAT(expressions, SizeIs(1));
-    const auto calcul = std::dynamic_pointer_cast<filc::BinaryCalcul>(expressions[0]);
+    const auto calcul = dynamic_cast<filc::BinaryCalcul *>(expressions[0]);
     ASSERT_NE(nullptr, calcul);
-    ASSERT_STREQ("+", calcul->getOperator().c_str());
+    ASSERT_EQ(filc::BinaryOperator::PLUS, calcul->getOperator());
     ASSERT_NE(nullptr, calcul->getLeftExpression());
     ASSERT_NE(nullptr, calcul->getRightExpression());
-    const auto left = std::dynamic_pointer_cast<filc::IntegerLiteral>(calcul->getLeftExpression());
+    const auto left = dynamic_cast<filc::IntegerLiteral *>(calcul->getLeftExpression());
     ASSERT_NE(nullptr, left);
     ASSERT_EQ(1, left->getValue());
-    const auto right = std::dynamic_pointer_cast<filc::IntegerLiteral>(calcul->getRightExpression());
+    const auto right = dynamic_cast<filc::IntegerLiteral *>(calcul->getRightExpression());
     ASSERT_NE(nullptr, right);
     ASSERT_EQ(2, right->getValue());
 }
@@ -51,15 +51,15 @@ TEST(BinaryCalcul, parsingAdditionGlued) { // issue #47
     const auto program     = parseString("1+2");
     const auto expressions = program->getExpressions();
     ASSERT_THAT(expressions, SizeIs(1));
-    const auto calcul = std::dynamic_pointer_cast<filc::BinaryCalcul>(expressions[0]);
+    const auto calcul = dynamic_cast<filc::BinaryCalcul *>(expressions[0]);
     ASSERT_NE(nullptr, calcul);
-    ASSERT_STREQ("+", calcul->getOperator().c_str());
+    ASSERT_EQ(filc::BinaryOperator::PLUS, calcul->getOperator());
     ASSERT_NE(nullptr, calcul->getLeftExpression());
     ASSERT_NE(nullptr, calcul->getRightExpression());
-    const auto left = std::dynamic_pointer_cast<filc::IntegerLiteral>(calcul->getLeftExpression());
+    const auto left = dynamic_cast<filc::IntegerLiteral *>(calcul->getLeftExpression());
     ASSERT_NE(nullptr, left);
     ASSERT_EQ(1, left->getValue());
-    const auto right = std::dynamic_pointer_cast<filc::IntegerLiteral>(calcul->getRightExpression());
+    const auto right = dynamic_cast<filc::IntegerLiteral *>(calcul->getRightExpression());
     ASSERT_NE(nullptr, right);
     ASSERT_EQ(2, right->getValue());
 }
@@ -115,3 +115,24 @@ TEST(BinaryCalcul, parsingPriorities) {
         ASSERT_STREQ("(false || (1 < (((2 % 3) * 4) + 5)))\n", visitor.getResult().c_str());
     }
 }
+
+TEST(BinaryCalcul, parsingPrioritiesWithArrayAccess) {
+    PrinterVisitor visitor;
+    const auto program = parseString("[1, 2][0] + 3 * [4][0] % 5");
+    program->acceptVoidVisitor(&visitor);
+    ASSERT_STREQ("([1, 2, ][0] + (3 * ([4, ][0] % 5)))\n", visitor.getResult().c_str());
+}
+
+TEST(BinaryCalcul, parsingLongChain) {
+    std::string content = "0";
+    for (int i = 0; i < 100000; i++) {
+        content += " + 1";
+    }
+    const auto program = parseString(content);
+    ASSERT_THAT(program->getExpressions(), SizeIs(1));
+    const auto calcul = dynamic_cast<filc::BinaryCalcul *>(program->getExpressions()[0]);
+    ASSERT_NE(nullptr, calcul);
+    const auto chain = calcul->getLeftChain();
+    ASSERT_THAT(chain, SizeIs(99999));
+    ASSERT_EQ(filc::ExpressionKind::INTEGER_LITERAL, chain.back()->getLeftExpression()->getKind());
+}
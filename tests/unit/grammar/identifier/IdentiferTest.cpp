@@ -33,7 +33,7 @@ TEST(Identifier, parsing) {
     const auto program     = parseString("myAwesome_var3");
     const auto expressions = program->getExpressions();
     ASSERT_THAT(expressions, SizeIs(1));
-    const auto identifier = std::dynamic_pointer_cast<filc::Identifier>(expressions[0]);
+    const auto identifier = dynamic_cast<filc::Identifier *>(expressions[0]);
     ASSERT_NE(nullptr, identifier);
     ASSERT_STREQ("myAwesome_var3", identifier->getName().c_str());
 }
@@ -33,7 +33,7 @@ TEST(BooleanLiteral, parsingTrue) {
     const auto program     = parseString("true");
     const auto expressions = program->getExpressions();
     ASSERT_THAT(expressions, SizeIs(1));
-    auto literal = std::dynamic_pointer_cast<filc::BooleanLiteral>(expressions[0]);
+    auto literal = dynamic_cast<filc::BooleanLiteral *>(expressions[0]);
     ASSERT_NE(nullptr, literal);
     ASSERT_TRUE(literal->getValue());
 }
@@ -42,7 +42,7 @@ TEST(BooleanLiteral, parsingFalse) {
     const auto program     = parseString("false");
     const auto expressions = program->getExpressions();
     ASSERT_THAT(expressions, SizeIs(1));
-    auto literal = std::dynamic_pointer_cast<filc::BooleanLiteral>(expressions[0]);
+    auto literal = dynamic_cast<filc::BooleanLiteral *>(expressions[0]);
     ASSERT_NE(nullptr, literal);
     ASSERT_FALSE(literal->getValue());
 }
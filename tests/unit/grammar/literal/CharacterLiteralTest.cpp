@@ -34,7 +34,7 @@ TEST(CharacterLiteral, parsingSimpleChar) {
     const auto program     = parseString("'a'");
     const auto expressions = program->getExpressions();
     ASSERT_THAT(expressions, SizeIs(1));
-    auto literal = std::dynamic_pointer_cast<filc::CharacterLiteral>(expressions[0]);
+    auto literal = dynamic_cast<filc::CharacterLiteral *>(expressions[0]);
     ASSERT_NE(nullptr, literal);
     ASSERT_EQ('a', literal->getValue());
 }
@@ -46,7 +46,7 @@ TEST(CharacterLiteral, parsingEscapedChar) {
         const auto program     = parseString(content);
         const auto expressions = program->getExpressions();
         ASSERT_THAT(expressions, SizeIs(1));
-        auto literal = std::dynamic_pointer_cast<filc::CharacterLiteral>(expressions[0]);
+        auto literal = dynamic_cast<filc::CharacterLiteral *>(expressions[0]);
         ASSERT_NE(nullptr, literal);
         ASSERT_EQ(filc::parseEscapedChar(content.substr(1, content.length() - 2)), literal->getValue());
     }
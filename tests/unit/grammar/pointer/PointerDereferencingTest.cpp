@@ -34,9 +34,9 @@ TEST(PointerDereferencing, parsing) {
     const auto program     = parseString("*foo");
     const auto expressions = program->getExpressions();
     ASSERT_THAT(expressions, SizeIs(1));
-    const auto pointer_dereferencing = std::dynamic_pointer_cast<filc::PointerDereferencing>(expressions[0]);
+    const auto pointer_dereferencing = dynamic_cast<filc::PointerDereferencing *>(expressions[0]);
     ASSERT_NE(nullptr, pointer_dereferencing);
-    const auto pointer = std::dynamic_pointer_cast<filc::Identifier>(pointer_dereferencing->getPointer());
+    const auto pointer = dynamic_cast<filc::Identifier *>(pointer_dereferencing->getPointer());
     ASSERT_NE(nullptr, pointer_dereferencing);
     ASSERT_STREQ("foo", pointer->getName().c_str());
 }
@@ -34,11 +34,11 @@ TEST(Pointer, parsing) {
     const auto program     = parseString("new i32(3)");
     const auto expressions = program->getExpressions();
     ASSERT_THAT(expressions, SizeIs(1));
-    const auto pointer = std::dynamic_pointer_cast<filc::Pointer>(expressions[0]);
+    const auto pointer = dynamic_cast<filc::Pointer *>(expressions[0]);
     ASSERT_NE(nullptr, pointer);
     ASSERT_STREQ("i32", pointer->getTypeName().c_str());
 
-    const auto value = std::dynamic_pointer_cast<filc::IntegerLiteral>(pointer->getValue());
+    const auto value = dynamic_cast<filc::IntegerLiteral *>(pointer->getValue());
     ASSERT_NE(nullptr, value);
     ASSERT_EQ(3, value->getValue());
 }
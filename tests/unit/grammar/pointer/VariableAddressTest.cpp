@@ -34,9 +34,9 @@ TEST(VariableAddress, parsing) {
     const auto program     = parseString("&foo");
     const auto expressions = program->getExpressions();
     ASSERT_THAT(expressions, SizeIs(1));
-    const auto variable_address = std::dynamic_pointer_cast<filc::VariableAddress>(expressions[0]);
+    const auto variable_address = dynamic_cast<filc::VariableAddress *>(expressions[0]);
     ASSERT_NE(nullptr, variable_address);
-    const auto variable = std::dynamic_pointer_cast<filc::Identifier>(variable_address->getVariable());
+    const auto variable = dynamic_cast<filc::Identifier *>(variable_address->getVariable());
     ASSERT_NE(nullptr, variable);
     ASSERT_STREQ("foo", variable->getName().c_str());
 }
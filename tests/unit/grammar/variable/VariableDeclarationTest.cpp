@@ -34,7 +34,7 @@ TEST(VariableDeclaration, parsingSimpleConstant) {
     const auto program     = parseString("val foo");
     const auto expressions = program->getExpressions();
     ASSERT_THAT(expressions, SizeIs(1));
-    auto variable = std::dynamic_pointer_cast<filc::VariableDeclaration>(expressions[0]);
+    auto variable = dynamic_cast<filc::VariableDeclaration *>(expressions[0]);
     ASSERT_NE(nullptr, variable);
     ASSERT_TRUE(variable->isConstant());
     ASSERT_STREQ("foo", variable->getName().c_str());
@@ -46,7 +46,7 @@ TEST(VariableDeclaration, parsingSimpleVariable) {
     const auto program     = parseString("var bar");
     const auto expressions = program->getExpressions();
     ASSERT_THAT(expressions, SizeIs(1));
-    auto variable = std::dynamic_pointer_cast<filc::VariableDeclaration>(expressions[0]);
+    auto variable = dynamic_cast<filc::VariableDeclaration *>(expressions[0]);
     ASSERT_NE(nullptr, variable);
     ASSERT_FALSE(variable->isConstant());
     ASSERT_STREQ("bar", variable->getName().c_str());
@@ -58,7 +58,7 @@ TEST(VariableDeclaration, parsingWithType) {
     const auto program     = parseString("var bar: i32");
     const auto expressions = program->getExpressions();
     ASSERT_THAT(expressions, SizeIs(1));
-    auto variable = std::dynamic_pointer_cast<filc::VariableDeclaration>(expressions[0]);
+    auto variable = dynamic_cast<filc::VariableDeclaration *>(expressions[0]);
     ASSERT_NE(nullptr, variable);
     ASSERT_FALSE(variable->isConstant());
     ASSERT_STREQ("bar", variable->getName().c_str());
@@ -70,22 +70,22 @@ TEST(VariableDeclaration, parsingWithValue) {
     const auto program     = parseString("val foo = 'a'");
     const auto expressions = program->getExpressions();
     ASSERT_THAT(expressions, SizeIs(1));
-    auto variable = std::dynamic_pointer_cast<filc::VariableDeclaration>(expressions[0]);
+    auto variable = dynamic_cast<filc::VariableDeclaration *>(expressions[0]);
     ASSERT_NE(nullptr, variable);
     ASSERT_TRUE(variable->isConstant());
     ASSERT_STREQ("foo", variable->getName().c_str());
     ASSERT_STREQ("", variable->getTypeName().c_str());
-    ASSERT_EQ('a', std::dynamic_pointer_cast<filc::CharacterLiteral>(variable->getValue())->getValue());
+    ASSERT_EQ('a', dynamic_cast<filc::CharacterLiteral *>(variable->getValue())->getValue());
 }
 
 TEST(VariableDeclaration, parsingWithTypeAndValue) {
     const auto program     = parseString("val foo: f64 = 3.1415");
     const auto expressions = program->getExpressions();
     ASSERT_THAT(expressions, SizeIs(1));
-    auto variable = std::dynamic_pointer_cast<filc::VariableDeclaration>(expressions[0]);
+    auto variable = dynamic_cast<filc::VariableDeclaration *>(expressions[0]);
     ASSERT_NE(nullptr, variable);
     ASSERT_TRUE(variable->isConstant());
     ASSERT_STREQ("foo", variable->getName().c_str());
     ASSERT_STREQ("f64", variable->getTypeName().c_str());
-    ASSERT_EQ(3.1415, std::dynamic_pointer_cast<filc::FloatLiteral>(variable->getValue())->getValue());
+    ASSERT_EQ(3.1415, dynamic_cast<filc::FloatLiteral *>(variable->getValue())->getValue());
 }
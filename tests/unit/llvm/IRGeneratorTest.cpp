@@ -27,15 +27,18 @@
 
 #include <filc/grammar/program/Program.h>
 #include <filc/llvm/IRGenerator.h>
+#include <filesystem>
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
+#include <sstream>
 
 using namespace ::testing;
 
 auto getIR(const std::string &content) -> std::string {
     const auto program = parseString(content);
     std::stringstream ss;
-    filc::ValidationVisitor validation_visitor(ss);
+    filc::Diagnostics diagnostics(ss);
+    filc::ValidationVisitor validation_visitor(diagnostics);
     program->acceptVoidVisitor(&validation_visitor);
     filc::IRGenerator generator("main", validation_visitor.getEnvironment());
     program->acceptIRVisitor(&generator);
@@ -94,6 +97,31 @@ TEST(IRGenerator, stringLiteral_notThrow) {
     ASSERT_THAT(ir, HasSubstr("ret i32 0"));
 }
 
+TEST(IRGenerator, stringLiteral_pooled) {
+    const auto program = parseString("val a = \"hello\"\nval b = \"hello\"\nval c = \"world\"\n0");
+    std::stringstream ss;
+    filc::Diagnostics diagnostics(ss);
+    filc::ValidationVisitor validation_visitor(diagnostics);
+    program->acceptVoidVisitor(&validation_visitor);
+    filc::IRGenerator generator("main", validation_visitor.getEnvironment());
+    program->acceptIRVisitor(&generator);
+
+    const auto ir = generator.dump();
+    ASSERT_THAT(ir, HasSubstr("c\"hello\\00\""));
+    ASSERT_EQ(ir.find("c\"hello\\00\""), ir.rfind("c\"hello\\00\""));
+    const auto &stats = generator.getStringPoolStats();
+    ASSERT_EQ(3, stats.literals);
+    ASSERT_EQ(2, stats.globals);
+    ASSERT_EQ(6, stats.saved_bytes);
+}
+
+TEST(IRGenerator, stringLiteral_suffixMerged) {
+    const auto ir = getIR("val a = \"world\"\nval b = \"hello world\"\nval c = \"ld\"\n0");
+    ASSERT_THAT(ir, HasSubstr("c\"hello world\\00\""));
+    ASSERT_THAT(ir, Not(HasSubstr("c\"world\\00\"")));
+    ASSERT_THAT(ir, Not(HasSubstr("c\"ld\\00\"")));
+}
+
 TEST(IRGenerator, variableDeclaration_value) {
     const auto ir = getIR("val bar = 3");
     ASSERT_THAT(ir, HasSubstr("ret i32 3"));
@@ -112,6 +140,20 @@ TEST(IRGenerator, calcul_integer) {
     ASSERT_THAT(getIR("3 % 2"), HasSubstr("ret i32 1"));
 }
 
+TEST(IRGenerator, calcul_longChain) {
+    std::string content = "0";
+    for (int i = 0; i < 100000; i++) {
+        content += " + 1";
+    }
+    ASSERT_THAT(getIR(content), HasSubstr("ret i32 100000"));
+}
+
+TEST(IRGenerator, calcul_folded) {
+    const auto ir = getIR("val foo = 1\n&foo == &foo");
+    ASSERT_THAT(ir, HasSubstr("ret i1 false"));
+    ASSERT_THAT(ir, Not(HasSubstr("alloca"))); // Addresses are only compared, never built
+}
+
 TEST(IRGenerator, assignation_notThrow) {
     const auto ir = getIR("var bar = 3\nbar = 0");
     ASSERT_THAT(ir, HasSubstr("ret i32 0"));
@@ -136,16 +178,43 @@ TEST(IRGenerator, variableAddress_notThrow) {
 }
 
 TEST(IRGenerator, array_notThrow) {
-    const auto ir = getIR("[1, 2, 3];0");
+    const auto ir = getIR("var foo = 1;[foo, 2, 3];0");
     ASSERT_THAT(ir, HasSubstr("alloca [3 x i32], i64 3, align 4"));
     ASSERT_THAT(ir, HasSubstr("store i32 1"));
     ASSERT_THAT(ir, HasSubstr("store i32 2"));
     ASSERT_THAT(ir, HasSubstr("store i32 3"));
 }
 
+TEST(IRGenerator, array_constant) {
+    const auto ir = getIR("[1, 2, 3];0");
+    ASSERT_THAT(ir, HasSubstr("private unnamed_addr constant [3 x i32] [i32 1, i32 2, i32 3]"));
+    ASSERT_THAT(ir, Not(HasSubstr("alloca")));
+    ASSERT_THAT(ir, Not(HasSubstr("store")));
+}
+
+TEST(IRGenerator, array_constantFolded) {
+    const auto ir = getIR("val foo = 2;[[foo, foo + 1], [4, 5 * 2]];0");
+    ASSERT_THAT(
+        ir,
+        HasSubstr("private unnamed_addr constant [2 x [2 x i32]] [[2 x i32] [i32 2, i32 3], [2 x i32] [i32 4, i32 10]]")
+    );
+    ASSERT_THAT(ir, Not(HasSubstr("alloca")));
+    ASSERT_THAT(ir, Not(HasSubstr("store")));
+}
+
+TEST(IRGenerator, array_constantMutable) {
+    const auto ir = getIR("var foo = [1, 2, 3];foo[1]");
+    ASSERT_THAT(ir, HasSubstr("private unnamed_addr constant [3 x i32] [i32 1, i32 2, i32 3]"));
+    ASSERT_THAT(ir, HasSubstr("alloca [3 x i32]"));
+    ASSERT_THAT(ir, HasSubstr("call void @llvm.memcpy"));
+    ASSERT_THAT(ir, Not(HasSubstr("store")));
+}
+
 TEST(IRGenerator, array_multiDimensions) {
-    const auto ir2D = getIR("[[1, 2], [3, 4]];0");
+    const auto ir2D = getIR("var foo = 1;[[foo, 2], [3, 4]];0");
     ASSERT_THAT(ir2D, HasSubstr("alloca [2 x [2 x i32]], i64 4, align 4"));
+    ASSERT_THAT(ir2D, HasSubstr("private unnamed_addr constant [2 x i32] [i32 3, i32 4]"));
+    ASSERT_THAT(ir2D, HasSubstr("call void @llvm.memcpy"));
 
     const auto ir3D = getIR(
         "["
@@ -155,10 +224,66 @@ TEST(IRGenerator, array_multiDimensions) {
         "]"
         ";0"
     );
-    ASSERT_THAT(ir3D, HasSubstr("alloca [3 x [3 x [3 x i32]]], i64 27, align 4"));
+    ASSERT_THAT(ir3D, HasSubstr("private unnamed_addr constant [3 x [3 x [3 x i32]]]"));
+    ASSERT_THAT(ir3D, Not(HasSubstr("store")));
+}
+
+TEST(IRGenerator, array_lateNonConstant) {
+    const auto ir = getIR("var foo = 1;[[1, 2], [3, 4], [5, foo]];0");
+    ASSERT_THAT(ir, HasSubstr("alloca [3 x [2 x i32]], i64 6, align 4"));
+    ASSERT_THAT(ir, HasSubstr("private unnamed_addr constant [2 x i32] [i32 1, i32 2]"));
+    ASSERT_THAT(ir, HasSubstr("private unnamed_addr constant [2 x i32] [i32 3, i32 4]"));
+    ASSERT_THAT(ir, HasSubstr("store i32 5"));
+    ASSERT_THAT(ir, Not(HasSubstr("[3 x [2 x i32]] [")));
+}
+
+TEST(IRGenerator, array_constantSize) {
+    const auto ir = getIR("val size = 1 + 2\nval foo: i32[size] = [1, 2, 3]\nfoo[2]");
+    ASSERT_THAT(ir, HasSubstr("[3 x i32]"));
 }
 
 TEST(IRGenerator, arrayAccess_notThrow) {
     const auto ir = getIR("val foo = [0];foo[0]");
-    ASSERT_THAT(ir, HasSubstr("ret i32 %3"));
+    ASSERT_THAT(ir, HasSubstr("load i32, ptr"));
+    ASSERT_THAT(ir, HasSubstr("@constant_array"));
+}
+
+TEST(IRGenerator, resolveTarget_native) {
+    std::string error;
+    const auto host = filc::IRGenerator::resolveTarget("", "native", "", error);
+    ASSERT_TRUE(error.empty());
+    ASSERT_NE("native", host.cpu);
+
+#if defined(__aarch64__)
+    const auto other_triple = "x86_64-unknown-linux-gnu";
+#else
+    const auto other_triple = "aarch64-unknown-linux-gnu";
+#endif
+    const auto other = filc::IRGenerator::resolveTarget(other_triple, "native", "", error);
+    ASSERT_THAT(error, HasSubstr(other_triple));
+    ASSERT_TRUE(other.triple.empty());
+}
+
+TEST(IRGenerator, toTarget_exeForeignTriple) {
+    const auto program = parseString("0");
+    std::stringstream ss;
+    filc::Diagnostics diagnostics(ss);
+    filc::ValidationVisitor validation_visitor(diagnostics);
+    program->acceptVoidVisitor(&validation_visitor);
+    std::stringstream err;
+    filc::IRGenerator generator("main", validation_visitor.getEnvironment(), err);
+    program->acceptIRVisitor(&generator);
+
+    // No cross toolchain uses this vendor
+#if defined(__aarch64__)
+    const auto other_triple = "x86_64-filc-linux-gnu";
+#else
+    const auto other_triple = "aarch64-filc-linux-gnu";
+#endif
+    ASSERT_EQ(0, generator.setupTarget(other_triple, "", "", "0"));
+    const auto output_file = std::filesystem::temp_directory_path() / "filc_foreign_exe";
+    ASSERT_EQ(1, generator.toTarget(output_file.string(), "exe"));
+    ASSERT_THAT(err.str(), HasSubstr(std::string(other_triple) + "-cc"));
+    ASSERT_THAT(err.str(), HasSubstr("--emit=obj"));
+    ASSERT_FALSE(std::filesystem::exists(output_file));
 }
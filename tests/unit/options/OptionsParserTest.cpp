@@ -23,9 +23,15 @@
  */
 #include "test_tools.h"
 
+#include <cstring>
 #include <filc/options/OptionsParser.h>
+#include <filc/server/CompilerServer.h>
+#include <filesystem>
 #include <gtest/gtest.h>
 #include <sstream>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
 
 TEST(OptionsParser, parse) {
     auto options_parser = filc::OptionsParser();
@@ -102,3 +108,201 @@ TEST(OptionsParser, getDump) {
     options_parser.parse(2, toStringArray({"filc", "--dump=ast"}).data());
     ASSERT_STREQ("ast", options_parser.getDump().c_str());
 }
+
+TEST(OptionsParser, getOptimizationLevel) {
+    auto options_parser = filc::OptionsParser();
+    SCOPED_TRACE("Default value");
+    options_parser.parse(1, toStringArray({"filc"}).data());
+    ASSERT_STREQ("0", options_parser.getOptimizationLevel().c_str());
+
+    SCOPED_TRACE("-O2");
+    options_parser.parse(2, toStringArray({"filc", "-O2"}).data());
+    ASSERT_STREQ("2", options_parser.getOptimizationLevel().c_str());
+
+    SCOPED_TRACE("-Os");
+    options_parser.parse(2, toStringArray({"filc", "-Os"}).data());
+    ASSERT_STREQ("s", options_parser.getOptimizationLevel().c_str());
+
+    SCOPED_TRACE("--opt-level=3");
+    options_parser.parse(2, toStringArray({"filc", "--opt-level=3"}).data());
+    ASSERT_STREQ("3", options_parser.getOptimizationLevel().c_str());
+
+    SCOPED_TRACE("Invalid value");
+    options_parser.parse(2, toStringArray({"filc", "-O4"}).data());
+    ASSERT_THROW(options_parser.getOptimizationLevel(), filc::OptionsParserException);
+}
+
+TEST(OptionsParser, getCpu) {
+    auto options_parser = filc::OptionsParser();
+    SCOPED_TRACE("Default value");
+    options_parser.parse(1, toStringArray({"filc"}).data());
+    ASSERT_STREQ("", options_parser.getCpu().c_str());
+    ASSERT_STREQ("", options_parser.getCpuFeatures().c_str());
+
+    SCOPED_TRACE("--mcpu=native");
+    options_parser.parse(2, toStringArray({"filc", "--mcpu=native"}).data());
+    ASSERT_STREQ("native", options_parser.getCpu().c_str());
+
+    SCOPED_TRACE("--mattr=+avx2,-sse4a");
+    options_parser.parse(2, toStringArray({"filc", "--mattr=+avx2,-sse4a"}).data());
+    ASSERT_STREQ("+avx2,-sse4a", options_parser.getCpuFeatures().c_str());
+}
+
+TEST(OptionsParser, isRun) {
+    auto options_parser = filc::OptionsParser();
+    options_parser.parse(2, toStringArray({"filc", "test.fil"}).data());
+    ASSERT_FALSE(options_parser.isRun());
+
+    options_parser.parse(3, toStringArray({"filc", "--run", "test.fil"}).data());
+    ASSERT_TRUE(options_parser.isRun());
+    ASSERT_STREQ("test.fil", options_parser.getFile().c_str());
+}
+
+TEST(OptionsParser, getOutputFile) {
+    auto options_parser = filc::OptionsParser();
+    options_parser.parse(2, toStringArray({"filc", "test.fil"}).data());
+    ASSERT_STREQ("a.out", options_parser.getOutputFile().c_str());
+    ASSERT_FALSE(options_parser.isOutputFileSet());
+
+    options_parser.parse(4, toStringArray({"filc", "-o", "test", "test.fil"}).data());
+    ASSERT_STREQ("test", options_parser.getOutputFile().c_str());
+    ASSERT_TRUE(options_parser.isOutputFileSet());
+}
+
+TEST(OptionsParser, getEmit) {
+    auto options_parser = filc::OptionsParser();
+    SCOPED_TRACE("Default value");
+    options_parser.parse(1, toStringArray({"filc"}).data());
+    ASSERT_STREQ("exe", options_parser.getEmit().c_str());
+
+    SCOPED_TRACE("--emit=obj");
+    options_parser.parse(2, toStringArray({"filc", "--emit=obj"}).data());
+    ASSERT_STREQ("obj", options_parser.getEmit().c_str());
+
+    SCOPED_TRACE("Invalid value");
+    options_parser.parse(2, toStringArray({"filc", "--emit=invalid"}).data());
+    ASSERT_THROW(options_parser.getEmit(), filc::OptionsParserException);
+}
+
+TEST(OptionsParser, getDiagnosticsFormat) {
+    auto options_parser = filc::OptionsParser();
+    SCOPED_TRACE("Default value");
+    options_parser.parse(1, toStringArray({"filc"}).data());
+    ASSERT_STREQ("text", options_parser.getDiagnosticsFormat().c_str());
+
+    SCOPED_TRACE("--diagnostics-format=sarif");
+    options_parser.parse(2, toStringArray({"filc", "--diagnostics-format=sarif"}).data());
+    ASSERT_STREQ("sarif", options_parser.getDiagnosticsFormat().c_str());
+
+    SCOPED_TRACE("Invalid value");
+    options_parser.parse(2, toStringArray({"filc", "--diagnostics-format=xml"}).data());
+    ASSERT_THROW(options_parser.getDiagnosticsFormat(), filc::OptionsParserException);
+}
+
+TEST(OptionsParser, warningOptions) {
+    auto options_parser = filc::OptionsParser();
+    SCOPED_TRACE("Default value");
+    options_parser.parse(1, toStringArray({"filc"}).data());
+    ASSERT_FALSE(options_parser.isWarningsDisabled());
+    ASSERT_FALSE(options_parser.isWarningsAsErrors());
+    ASSERT_TRUE(options_parser.getDisabledWarnings().empty());
+    ASSERT_EQ(0, options_parser.getMaxDiagnostics());
+
+    SCOPED_TRACE("All options");
+    options_parser.parse(
+        5, toStringArray({"filc", "-w", "-Wno-unused-value", "-Werror", "--max-diagnostics=20"}).data()
+    );
+    ASSERT_TRUE(options_parser.isWarningsDisabled());
+    ASSERT_TRUE(options_parser.isWarningsAsErrors());
+    ASSERT_EQ(std::vector<std::string>({"unused-value"}), options_parser.getDisabledWarnings());
+    ASSERT_EQ(20, options_parser.getMaxDiagnostics());
+
+    SCOPED_TRACE("Invalid value");
+    options_parser.parse(2, toStringArray({"filc", "-Wall"}).data());
+    ASSERT_THROW((void) options_parser.isWarningsAsErrors(), filc::OptionsParserException);
+}
+
+TEST(OptionsParser, timeOptions) {
+    auto options_parser = filc::OptionsParser();
+    options_parser.parse(1, toStringArray({"filc"}).data());
+    ASSERT_FALSE(options_parser.isTimeReport());
+    ASSERT_FALSE(options_parser.isTimeTrace());
+
+    options_parser.parse(3, toStringArray({"filc", "--time-report", "--time-trace"}).data());
+    ASSERT_TRUE(options_parser.isTimeReport());
+    ASSERT_TRUE(options_parser.isTimeTrace());
+}
+
+TEST(OptionsParser, getFiles) {
+    auto options_parser = filc::OptionsParser();
+    SCOPED_TRACE("No file");
+    options_parser.parse(1, toStringArray({"filc"}).data());
+    ASSERT_TRUE(options_parser.getFiles().empty());
+
+    SCOPED_TRACE("Positional arguments");
+    options_parser.parse(4, toStringArray({"filc", "a.fil", "b.fil", "c.fil"}).data());
+    ASSERT_EQ(std::vector<std::string>({"a.fil", "b.fil", "c.fil"}), options_parser.getFiles());
+    ASSERT_STREQ("a.fil", options_parser.getFile().c_str());
+}
+
+TEST(OptionsParser, getJobs) {
+    auto options_parser = filc::OptionsParser();
+    options_parser.parse(1, toStringArray({"filc"}).data());
+    ASSERT_EQ(0, options_parser.getJobs());
+
+    options_parser.parse(3, toStringArray({"filc", "-j", "4"}).data());
+    ASSERT_EQ(4, options_parser.getJobs());
+}
+
+TEST(OptionsParser, getServerSocket) {
+    auto options_parser = filc::OptionsParser();
+    SCOPED_TRACE("Default value");
+    options_parser.parse(2, toStringArray({"filc", "test.fil"}).data());
+    ASSERT_STREQ("", options_parser.getServerSocket().c_str());
+    ASSERT_STREQ("", options_parser.getConnectSocket().c_str());
+
+    SCOPED_TRACE("Implicit value");
+    options_parser.parse(2, toStringArray({"filc", "--server"}).data());
+    ASSERT_EQ(filc::CompilerServer::getDefaultSocketPath(), options_parser.getServerSocket());
+
+    SCOPED_TRACE("--connect=/tmp/other.sock");
+    options_parser.parse(3, toStringArray({"filc", "--connect=/tmp/other.sock", "test.fil"}).data());
+    ASSERT_STREQ("/tmp/other.sock", options_parser.getConnectSocket().c_str());
+    ASSERT_STREQ("test.fil", options_parser.getFile().c_str());
+
+    SCOPED_TRACE("--connect <socket>");
+    const auto socket_path = (std::filesystem::temp_directory_path() / "filc_options_parser_test.sock").string();
+    std::filesystem::remove(socket_path);
+    sockaddr_un address {};
+    address.sun_family = AF_UNIX;
+    std::strcpy(address.sun_path, socket_path.c_str());
+    const auto socket_fd = socket(AF_UNIX, SOCK_STREAM, 0);
+    ASSERT_EQ(0, bind(socket_fd, reinterpret_cast<sockaddr *>(&address), sizeof(address)));
+    options_parser.parse(4, toStringArray({"filc", "--connect", socket_path, "test.fil"}).data());
+    ASSERT_EQ(socket_path, options_parser.getConnectSocket());
+    ASSERT_EQ(std::vector<std::string>({"test.fil"}), options_parser.getFiles());
+    close(socket_fd);
+    std::filesystem::remove(socket_path);
+
+    SCOPED_TRACE("--connect <file>");
+    options_parser.parse(3, toStringArray({"filc", "--connect", "test.fil"}).data());
+    ASSERT_EQ(filc::CompilerServer::getDefaultSocketPath(), options_parser.getConnectSocket());
+    ASSERT_STREQ("test.fil", options_parser.getFile().c_str());
+}
+
+TEST(OptionsParser, getCacheDirectory) {
+    auto options_parser = filc::OptionsParser();
+    SCOPED_TRACE("Default value");
+    options_parser.parse(2, toStringArray({"filc", "test.fil"}).data());
+    ASSERT_STREQ("", options_parser.getCacheDirectory().c_str());
+    ASSERT_EQ(1024, options_parser.getCacheSize());
+    ASSERT_FALSE(options_parser.isCacheStats());
+
+    SCOPED_TRACE("Cache options");
+    options_parser.parse(
+        4, toStringArray({"filc", "--cache-dir=/tmp/cache", "--cache-size=64", "--cache-stats"}).data()
+    );
+    ASSERT_STREQ("/tmp/cache", options_parser.getCacheDirectory().c_str());
+    ASSERT_EQ(64, options_parser.getCacheSize());
+    ASSERT_TRUE(options_parser.isCacheStats());
+}
@@ -0,0 +1,139 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2025-Present Kevin Traini
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <filc/server/CompilerServer.h>
+#include <filesystem>
+#include <gtest/gtest.h>
+#include <sstream>
+#include <stdexcept>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <thread>
+#include <unistd.h>
+
+namespace {
+// mkdtemp creates the directory with 0700, as the server requires
+auto makeSocketDirectory() -> std::filesystem::path {
+    auto pattern = (std::filesystem::temp_directory_path() / "filc_test_XXXXXX").string();
+    if (mkdtemp(pattern.data()) == nullptr) {
+        throw std::runtime_error("Could not create temporary directory");
+    }
+    return pattern;
+}
+} // namespace
+
+TEST(CompilerServer, requests) {
+    const auto directory   = makeSocketDirectory();
+    const auto socket_path = (directory / "filc.sock").string();
+    filc::CompilerServer server(socket_path);
+    ASSERT_EQ(0, server.open());
+    std::thread server_thread([&server] {
+        ASSERT_EQ(0, server.serve());
+    });
+
+    const filc::CompilerClient client(socket_path);
+    {
+        SCOPED_TRACE("--version");
+        std::stringstream out;
+        std::stringstream err;
+        ASSERT_EQ(0, client.send({"filc", "--version"}, out, err));
+        ASSERT_STREQ(FILC_VERSION "\n", out.str().c_str());
+    }
+    {
+        SCOPED_TRACE("Missing file");
+        std::stringstream out;
+        std::stringstream err;
+        ASSERT_EQ(1, client.send({"filc", FIXTURES_PATH "/missing.fil"}, out, err));
+        ASSERT_FALSE(err.str().empty());
+    }
+    {
+        SCOPED_TRACE("--dump=ast");
+        std::stringstream out;
+        std::stringstream err;
+        ASSERT_EQ(0, client.send({"filc", "--dump=ast", FIXTURES_PATH "/valid.fil"}, out, err));
+        ASSERT_STREQ("=== Begin AST dump ===\n[Integer:0]\n=== End AST dump ===\n", out.str().c_str());
+    }
+    for (const auto &option : {"--run", "--server", "--connect"}) {
+        SCOPED_TRACE(option);
+        std::stringstream out;
+        std::stringstream err;
+        ASSERT_EQ(1, client.send({"filc", option, FIXTURES_PATH "/valid.fil"}, out, err));
+        ASSERT_STREQ("--run, --server and --connect can't be handled by the compile server", err.str().c_str());
+    }
+
+    server.stop();
+    server_thread.join();
+    std::filesystem::remove_all(directory);
+}
+
+TEST(CompilerServer, malformedRequest) {
+    const auto directory   = makeSocketDirectory();
+    const auto socket_path = (directory / "filc.sock").string();
+    filc::CompilerServer server(socket_path);
+    ASSERT_EQ(0, server.open());
+    std::thread server_thread([&server] {
+        ASSERT_EQ(0, server.serve());
+    });
+
+    SCOPED_TRACE("Oversized argument count");
+    sockaddr_un address {};
+    address.sun_family = AF_UNIX;
+    std::strcpy(address.sun_path, socket_path.c_str());
+    const auto client = socket(AF_UNIX, SOCK_STREAM, 0);
+    ASSERT_EQ(0, connect(client, reinterpret_cast<sockaddr *>(&address), sizeof(address)));
+    const uint32_t request[] = {0, 0xFFFFFFFF};
+    ASSERT_EQ(static_cast<ssize_t>(sizeof(request)), write(client, request, sizeof(request)));
+    char response;
+    ASSERT_EQ(0, read(client, &response, sizeof(response)));
+    close(client);
+
+    SCOPED_TRACE("Server still running");
+    std::stringstream out;
+    std::stringstream err;
+    ASSERT_EQ(0, filc::CompilerClient(socket_path).send({"filc", "--version"}, out, err));
+
+    server.stop();
+    server_thread.join();
+    std::filesystem::remove_all(directory);
+}
+
+TEST(CompilerServer, sharedDirectory) {
+    const auto directory = makeSocketDirectory();
+    std::filesystem::permissions(directory, std::filesystem::perms::all);
+    filc::CompilerServer server((directory / "filc.sock").string());
+    ASSERT_EQ(1, server.open());
+    std::filesystem::remove_all(directory);
+}
+
+TEST(CompilerClient, noServer) {
+    const auto directory = makeSocketDirectory();
+    std::stringstream out;
+    std::stringstream err;
+    ASSERT_EQ(1, filc::CompilerClient((directory / "filc.sock").string()).send({"filc", "--version"}, out, err));
+    ASSERT_TRUE(out.str().empty());
+    ASSERT_FALSE(err.str().empty());
+    std::filesystem::remove_all(directory);
+}
@@ -54,7 +54,8 @@ auto parseString(const std::string &content) -> std::shared_ptr<filc::Program> {
 auto parseAndValidateString(const std::string &content) -> std::shared_ptr<filc::Program> {
     const auto program = parseString(content);
     std::stringstream ss;
-    filc::ValidationVisitor validation_visitor(ss);
+    filc::Diagnostics diagnostics(ss);
+    filc::ValidationVisitor validation_visitor(diagnostics);
     program->acceptVoidVisitor(&validation_visitor);
     return program;
 }
@@ -111,7 +112,7 @@ auto PrinterVisitor::visitIdentifier(filc::Identifier *identifier) -> void {
 auto PrinterVisitor::visitBinaryCalcul(filc::BinaryCalcul *calcul) -> void {
     _out << "(";
     calcul->getLeftExpression()->acceptVoidVisitor(this);
-    _out << " " << calcul->getOperator() << " ";
+    _out << " " << filc::toString(calcul->getOperator()) << " ";
     calcul->getRightExpression()->acceptVoidVisitor(this);
     _out << ")";
 }
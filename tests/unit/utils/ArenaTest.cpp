@@ -0,0 +1,81 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2025-Present Kevin Traini
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include <cstdint>
+#include <filc/utils/Arena.h>
+#include <gtest/gtest.h>
+#include <string>
+
+class DestructionCounter {
+  public:
+    explicit DestructionCounter(int *counter): _counter(counter) {}
+
+    ~DestructionCounter() {
+        (*_counter)++;
+    }
+
+  private:
+    int *_counter;
+};
+
+TEST(Arena, make) {
+    filc::Arena arena;
+    const auto value = arena.make<int>(3);
+    ASSERT_EQ(3, *value);
+    const auto string = arena.make<std::string>("Hello World");
+    ASSERT_STREQ("Hello World", string->c_str());
+    ASSERT_EQ(sizeof(int) + sizeof(std::string), arena.getAllocatedSize());
+    ASSERT_EQ(2, arena.getObjectCount());
+    ASSERT_EQ(1, arena.getDestructorCount());
+}
+
+TEST(Arena, alignment) {
+    filc::Arena arena;
+    arena.make<char>('a');
+    const auto value = arena.make<double>(2.5);
+    ASSERT_EQ(0, reinterpret_cast<uintptr_t>(value) % alignof(double));
+}
+
+TEST(Arena, bigAllocation) {
+    filc::Arena arena;
+    struct Big {
+        char data[256 * 1024];
+    };
+    const auto big    = arena.make<Big>();
+    big->data[0]      = 'a';
+    const auto little = arena.make<int>(12);
+    ASSERT_EQ('a', big->data[0]);
+    ASSERT_EQ(12, *little);
+}
+
+TEST(Arena, destructors) {
+    int counter = 0;
+    {
+        filc::Arena arena;
+        for (int i = 0; i < 10000; i++) {
+            arena.make<DestructionCounter>(&counter);
+        }
+        ASSERT_EQ(0, counter);
+    }
+    ASSERT_EQ(10000, counter);
+}
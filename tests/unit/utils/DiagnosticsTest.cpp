@@ -0,0 +1,221 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2025-Present Kevin Traini
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "test_tools.h"
+
+#include <algorithm>
+#include <filc/utils/Diagnostics.h>
+#include <gtest/gtest.h>
+#include <sstream>
+
+#define FILENAME FIXTURES_PATH "/ipsum.txt"
+#define POSITION filc::Position(new TokenStub(FILENAME, {1, 6}), new TokenStub(FILENAME, {2, 3}))
+
+TEST(Diagnostics, getFormat) {
+    ASSERT_EQ(filc::DiagnosticsFormat::TEXT, filc::Diagnostics::getFormat("text"));
+    ASSERT_EQ(filc::DiagnosticsFormat::JSON, filc::Diagnostics::getFormat("json"));
+    ASSERT_EQ(filc::DiagnosticsFormat::SARIF, filc::Diagnostics::getFormat("sarif"));
+    ASSERT_THROW((void) filc::Diagnostics::getFormat("xml"), std::logic_error);
+}
+
+TEST(Diagnostics, flush) {
+    std::stringstream ss;
+    filc::Diagnostics diagnostics(ss);
+    diagnostics.report(filc::Severity::WARNING, "unused-value", "Value not used", POSITION);
+    ASSERT_FALSE(diagnostics.hasError());
+    ASSERT_EQ(1, diagnostics.getPending().size());
+    ASSERT_TRUE(ss.str().empty());
+
+    diagnostics.report(filc::Severity::ERROR, "unknown-name", "Unknown name", POSITION);
+    diagnostics.flush();
+    ASSERT_TRUE(diagnostics.hasError());
+    ASSERT_TRUE(diagnostics.getPending().empty());
+    const auto result = ss.str();
+    ASSERT_EQ(0, result.find("\x1B[1m\x1B[33m[WARNING] \x1B[0mValue not used\n"));
+    ASSERT_NE(std::string::npos, result.find("\x1B[1m\x1B[31m[ERROR] \x1B[0mUnknown name\n"));
+
+    diagnostics.flush();
+    ASSERT_EQ(result, ss.str());
+}
+
+TEST(Diagnostics, json) {
+    std::stringstream ss;
+    filc::Diagnostics diagnostics(ss, filc::DiagnosticsFormat::JSON);
+    diagnostics.report(filc::Severity::WARNING, "unused-value", "Value \"a\" not used", POSITION);
+    diagnostics.report(filc::Severity::ERROR, "unknown-name", "Unknown name", POSITION);
+    diagnostics.flush();
+    ASSERT_EQ(
+        R"({"severity":"warning","code":"unused-value","file":")" FILENAME
+        R"(","line":1,"column":6,"end_line":2,"end_column":3,"message":"Value \"a\" not used"})"
+        "\n"
+        R"({"severity":"error","code":"unknown-name","file":")" FILENAME
+        R"(","line":1,"column":6,"end_line":2,"end_column":3,"message":"Unknown name"})"
+        "\n",
+        ss.str()
+    );
+}
+
+TEST(Diagnostics, sarif) {
+    std::stringstream ss;
+    filc::Diagnostics diagnostics(ss, filc::DiagnosticsFormat::SARIF);
+    diagnostics.report(filc::Severity::ERROR, "unknown-name", "Unknown name", POSITION);
+    diagnostics.flush();
+    ASSERT_TRUE(ss.str().empty());
+    filc::Diagnostics::writeSarifLog(ss, {&diagnostics});
+    const auto result = ss.str();
+    ASSERT_EQ(0, result.find(R"({"version":"2.1.0",)"));
+    ASSERT_NE(std::string::npos, result.find(R"("tool":{"driver":{"name":"filc","version":")" FILC_VERSION));
+    ASSERT_NE(
+        std::string::npos,
+        result.find(
+            R"({"ruleId":"unknown-name","level":"error","message":{"text":"Unknown name"},"locations":[{)"
+            R"("physicalLocation":{"artifactLocation":{"uri":")" FILENAME
+            R"("},"region":{"startLine":1,"startColumn":7,"endLine":2,"endColumn":4}}}]})"
+        )
+    );
+    ASSERT_EQ("]}]}\n", result.substr(result.length() - 5));
+}
+
+TEST(Diagnostics, sarifSingleLog) {
+    std::stringstream ss;
+    filc::Diagnostics first(ss, filc::DiagnosticsFormat::SARIF);
+    filc::Diagnostics second(ss, filc::DiagnosticsFormat::SARIF);
+    filc::Diagnostics empty(ss, filc::DiagnosticsFormat::SARIF);
+    first.report(filc::Severity::ERROR, "syntax-error", "Syntax error", POSITION);
+    first.flush();
+    first.report(filc::Severity::WARNING, "unused-value", "Value not used", POSITION);
+    first.flush();
+    second.report(filc::Severity::ERROR, "unknown-name", "Unknown name", POSITION);
+    second.flush();
+
+    filc::Diagnostics::writeSarifLog(ss, {&empty});
+    ASSERT_TRUE(ss.str().empty());
+    filc::Diagnostics::writeSarifLog(ss, {&first, &empty, &second});
+    const auto result = ss.str();
+    ASSERT_EQ(0, result.find(R"({"version":"2.1.0",)"));
+    ASSERT_EQ(std::string::npos, result.find(R"("version":"2.1.0")", 1));
+    const auto syntax_error = result.find(R"({"ruleId":"syntax-error")");
+    const auto unused_value = result.find(R"(},{"ruleId":"unused-value")");
+    const auto unknown_name = result.find(R"(},{"ruleId":"unknown-name")");
+    ASSERT_NE(std::string::npos, syntax_error);
+    ASSERT_NE(std::string::npos, unused_value);
+    ASSERT_NE(std::string::npos, unknown_name);
+    ASSERT_LT(syntax_error, unused_value);
+    ASSERT_LT(unused_value, unknown_name);
+    ASSERT_EQ(1, std::count(result.begin(), result.end(), '\n'));
+}
+
+TEST(Diagnostics, disableWarnings) {
+    std::stringstream ss;
+    filc::Diagnostics diagnostics(ss);
+    diagnostics.disableWarning("unused-value");
+    ASSERT_FALSE(diagnostics.isWarningEnabled("unused-value"));
+    ASSERT_TRUE(diagnostics.isWarningEnabled("other"));
+    diagnostics.report(filc::Severity::WARNING, "unused-value", "Value not used", POSITION);
+    diagnostics.report(filc::Severity::WARNING, "other", "Other warning", POSITION);
+    ASSERT_EQ(1, diagnostics.getPending().size());
+
+    diagnostics.disableWarnings();
+    ASSERT_FALSE(diagnostics.isWarningEnabled("other"));
+    diagnostics.report(filc::Severity::WARNING, "other", "Other warning", POSITION);
+    diagnostics.report(filc::Severity::ERROR, "unknown-name", "Unknown name", POSITION);
+    ASSERT_EQ(2, diagnostics.getPending().size());
+    ASSERT_TRUE(diagnostics.hasError());
+}
+
+TEST(Diagnostics, warningsAsErrors) {
+    std::stringstream ss;
+    filc::Diagnostics diagnostics(ss);
+    diagnostics.setWarningsAsErrors(true);
+    diagnostics.report(filc::Severity::WARNING, "unused-value", "Value not used", POSITION);
+    ASSERT_TRUE(diagnostics.hasError());
+    ASSERT_EQ(filc::Severity::ERROR, diagnostics.getPending()[0].severity);
+}
+
+TEST(Diagnostics, maxDiagnostics) {
+    std::stringstream ss;
+    filc::Diagnostics diagnostics(ss, filc::DiagnosticsFormat::JSON);
+    diagnostics.setMaxDiagnostics(2);
+    diagnostics.report(filc::Severity::WARNING, "unused-value", "Value not used", POSITION);
+    diagnostics.report(filc::Severity::WARNING, "unused-value", "Value not used", POSITION);
+    diagnostics.report(filc::Severity::ERROR, "unknown-name", "Unknown name", POSITION);
+    ASSERT_EQ(2, diagnostics.getPending().size());
+    ASSERT_TRUE(diagnostics.hasError());
+    diagnostics.flush();
+    const auto result = ss.str();
+    ASSERT_EQ(3, std::count(result.begin(), result.end(), '\n'));
+    ASSERT_NE(
+        std::string::npos,
+        result.find(
+            R"({"severity":"note","code":"max-diagnostics","message":"1 more diagnostics not shown, limit of 2 )"
+            R"(reached"})"
+        )
+    );
+}
+
+TEST(Diagnostics, maxDiagnosticsSarif) {
+    std::stringstream ss;
+    filc::Diagnostics diagnostics(ss, filc::DiagnosticsFormat::SARIF);
+    diagnostics.setMaxDiagnostics(1);
+    diagnostics.report(filc::Severity::WARNING, "unused-value", "Value not used", POSITION);
+    diagnostics.report(filc::Severity::ERROR, "unknown-name", "Unknown name", POSITION);
+    diagnostics.flush();
+    filc::Diagnostics::writeSarifLog(ss, {&diagnostics});
+    ASSERT_NE(
+        std::string::npos,
+        ss.str().find(
+            R"({"ruleId":"max-diagnostics","level":"note","message":{"text":"1 more diagnostics not shown, limit of 1 )"
+            R"(reached"}})"
+        )
+    );
+}
+
+TEST(Diagnostics, replay) {
+    std::stringstream recorded_out;
+    filc::Diagnostics recorded(recorded_out);
+    recorded.recordReported();
+    recorded.report(filc::Severity::WARNING, "unused-value", "Value\nnot used", POSITION);
+    recorded.report(filc::Severity::WARNING, "unused-value", "Value not used", filc::Position());
+    recorded.flush();
+    const auto serialized = recorded.serializeReported();
+
+    std::stringstream ss;
+    filc::Diagnostics diagnostics(ss, filc::DiagnosticsFormat::JSON);
+    diagnostics.setWarningsAsErrors(true);
+    diagnostics.setMaxDiagnostics(1);
+    const auto source = filc::SourceBuffer::open(FILENAME);
+    ASSERT_TRUE(diagnostics.replay(serialized, source.get()));
+    diagnostics.flush();
+    ASSERT_TRUE(diagnostics.hasError());
+    ASSERT_EQ(
+        R"({"severity":"error","code":"unused-value","file":")" FILENAME
+        R"(","line":1,"column":6,"end_line":2,"end_column":3,"message":"Value\nnot used"})"
+        "\n"
+        R"({"severity":"note","code":"max-diagnostics","message":"1 more diagnostics not shown, limit of 1 reached"})"
+        "\n",
+        ss.str()
+    );
+
+    SCOPED_TRACE("Malformed");
+    ASSERT_FALSE(diagnostics.replay(serialized.substr(0, serialized.size() - 1), source.get()));
+}
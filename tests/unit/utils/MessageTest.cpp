@@ -30,7 +30,7 @@
 
 TEST(Message, write) {
     filc::Message message(
-        WARNING,
+        WARNING_TAG,
         "This is a warning message",
         filc::Position(new TokenStub(FILENAME, {1, 7}), new TokenStub(FILENAME, {1, 7})),
         WARNING_COLOR
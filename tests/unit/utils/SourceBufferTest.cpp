@@ -0,0 +1,62 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2025-Present Kevin Traini
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include <filc/utils/SourceBuffer.h>
+#include <gtest/gtest.h>
+
+#define FILENAME FIXTURES_PATH "/ipsum.txt"
+
+TEST(SourceBuffer, open) {
+    const auto source = filc::SourceBuffer::open(FILENAME);
+    ASSERT_EQ(FILENAME, source->getName());
+    ASSERT_EQ(0, source->getContent().find("Lorem ipsum dolor sit amet"));
+    ASSERT_EQ(
+        "Lorem ipsum dolor sit amet, consectetur adipiscing elit. Ut pharetra volutpat fermentum.", source->getLine(1)
+    );
+    ASSERT_EQ(
+        "at dui nunc. Nam ligula augue, tempus id vestibulum nec, rutrum porttitor nibh. Nullam non", source->getLine(4)
+    );
+}
+
+TEST(SourceBuffer, open_throw) {
+    ASSERT_THROW(filc::SourceBuffer::open(FIXTURES_PATH "/not_existing.fil"), std::logic_error);
+    ASSERT_THROW(filc::SourceBuffer::open(FIXTURES_PATH), std::logic_error);
+}
+
+TEST(SourceBuffer, getLine) {
+    const filc::SourceBuffer source("<memory>", "first\nsecond\n\nfourth");
+    ASSERT_EQ(4, source.getLineCount());
+    ASSERT_EQ("first", source.getLine(1));
+    ASSERT_EQ("second", source.getLine(2));
+    ASSERT_EQ("", source.getLine(3));
+    ASSERT_EQ("fourth", source.getLine(4));
+    ASSERT_EQ("", source.getLine(0));
+    ASSERT_EQ("", source.getLine(5));
+}
+
+TEST(SourceBuffer, empty) {
+    const filc::SourceBuffer source("<memory>", "");
+    ASSERT_EQ(1, source.getLineCount());
+    ASSERT_EQ("", source.getLine(1));
+    ASSERT_TRUE(source.getContent().empty());
+}
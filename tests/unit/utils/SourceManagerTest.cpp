@@ -0,0 +1,56 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2025-Present Kevin Traini
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include <filc/utils/SourceManager.h>
+#include <gtest/gtest.h>
+
+#define FILENAME FIXTURES_PATH "/ipsum.txt"
+
+TEST(SourceManager, load) {
+    filc::SourceManager sources;
+    const auto source = sources.load(FILENAME);
+    ASSERT_NE(nullptr, source);
+    ASSERT_EQ(FILENAME, source->getName());
+    ASSERT_EQ(source, sources.load(FILENAME));
+    ASSERT_EQ(source, sources.find(FILENAME));
+}
+
+TEST(SourceManager, load_throw) {
+    filc::SourceManager sources;
+    ASSERT_THROW((void) sources.load(FIXTURES_PATH "/not_existing.fil"), std::logic_error);
+    ASSERT_EQ(nullptr, sources.find(FIXTURES_PATH "/not_existing.fil"));
+}
+
+TEST(SourceManager, add) {
+    filc::SourceManager sources;
+    const auto source = sources.add("<memory>", "first\nsecond");
+    ASSERT_EQ("second", source->getLine(2));
+    ASSERT_EQ(source, sources.find("<memory>"));
+    ASSERT_EQ(source, sources.load("<memory>"));
+    ASSERT_THROW(sources.add("<memory>", ""), std::logic_error);
+}
+
+TEST(SourceManager, find) {
+    const filc::SourceManager sources;
+    ASSERT_EQ(nullptr, sources.find("<memory>"));
+}
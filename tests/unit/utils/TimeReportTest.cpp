@@ -0,0 +1,86 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2025-Present Kevin Traini
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include <filc/utils/TimeReport.h>
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+#include <sstream>
+
+using namespace ::testing;
+
+TEST(TimeReport, scope) {
+    filc::TimeReport report("main.fil");
+    {
+        filc::TimeScope lexing(&report, "Lexing");
+        lexing.stop();
+        filc::TimeScope parsing(&report, "Parsing");
+    }
+    ASSERT_THAT(report.getPhases(), SizeIs(2));
+    ASSERT_EQ("Lexing", report.getPhases()[0].name);
+    ASSERT_EQ("Parsing", report.getPhases()[1].name);
+    ASSERT_LE(report.getPhases()[0].start + report.getPhases()[0].wall_time, report.getPhases()[1].start);
+    ASSERT_GE(report.getPhases()[1].max_rss_growth_kib, 0);
+}
+
+TEST(TimeReport, scopeWithoutReport) {
+    filc::TimeScope scope(nullptr, "Lexing");
+    scope.stop();
+}
+
+TEST(TimeReport, write) {
+    filc::TimeReport report("main.fil");
+    report.addPhase({"Lexing", std::chrono::microseconds(0), std::chrono::microseconds(1500), {}, 2048});
+    report.addPhase({"Parsing", std::chrono::microseconds(1500), std::chrono::microseconds(500), {}, 1024});
+    report.setCounter("Tokens", 12);
+    report.setCounter("Tokens", 14);
+    report.addSection("LLVM passes", "Some timings\n");
+    report.addSection("Empty", "");
+    std::stringstream ss;
+    report.write(ss);
+    const auto result = ss.str();
+    ASSERT_THAT(result, StartsWith("=== Time report: main.fil ===\n"));
+    ASSERT_THAT(result, HasSubstr("RSS growth (MiB)\n"));
+    ASSERT_THAT(result, HasSubstr("Lexing                     1.500       0.000               2.0\n"));
+    ASSERT_THAT(result, HasSubstr("Parsing                    0.500       0.000               1.0\n"));
+    ASSERT_THAT(result, HasSubstr("Total                      2.000       0.000               3.0\n"));
+    ASSERT_THAT(result, HasSubstr("Tokens: 14\n"));
+    ASSERT_THAT(result, HasSubstr("=== LLVM passes ===\nSome timings\n"));
+    ASSERT_THAT(result, Not(HasSubstr("Empty")));
+}
+
+TEST(TimeReport, writeTrace) {
+    filc::TimeReport report("main.fil");
+    report.addPhase({"Lexing", std::chrono::microseconds(10), std::chrono::microseconds(40), {}, 0});
+    report.addPhase({"Parsing", std::chrono::microseconds(50), std::chrono::microseconds(25), {}, 0});
+    report.setCounter("Arena objects", 3);
+    std::stringstream ss;
+    report.writeTrace(ss);
+    const auto result = ss.str();
+    ASSERT_THAT(result, StartsWith(R"({"traceEvents":[{"name":"process_name","ph":"M",)"));
+    ASSERT_THAT(result, HasSubstr(R"({"name":"Lexing","ph":"X",)"));
+    ASSERT_THAT(result, HasSubstr(R"("ts":10,"dur":40,"args":{"detail":"main.fil"}})"));
+    ASSERT_THAT(result, HasSubstr(R"({"name":"Total","ph":"X",)"));
+    ASSERT_THAT(result, HasSubstr(R"("ts":10,"dur":65,"args":{"detail":"main.fil"}})"));
+    ASSERT_THAT(result, HasSubstr(R"("args":{"Arena objects":3}})"));
+    ASSERT_THAT(result, EndsWith("],\"displayTimeUnit\":\"ms\"}\n"));
+}
@@ -42,3 +42,11 @@ TEST(Utils, parseEscapedChar) {
     ASSERT_EQ('a', filc::parseEscapedChar("ab"));
     ASSERT_EQ('\\', filc::parseEscapedChar("\\q"));
 }
+
+TEST(Utils, toJsonString) {
+    ASSERT_EQ("\"\"", filc::toJsonString(""));
+    ASSERT_EQ("\"foo.fil\"", filc::toJsonString("foo.fil"));
+    ASSERT_EQ("\"say \\\"hi\\\"\\\\\"", filc::toJsonString("say \"hi\"\\"));
+    ASSERT_EQ("\"a\\nb\\tc\\u001b\"", filc::toJsonString("a\nb\tc\x1B"));
+    ASSERT_EQ("\"val é\"", filc::toJsonString("val é"));
+}
@@ -26,28 +26,48 @@
 #include <gtest/gtest.h>
 #include <memory>
 
+using filc::BinaryOperator;
+
 #define VALIDATOR                       \
     auto env = new filc::Environment(); \
     filc::CalculValidator validator(env)
 
 TEST(CalculValidator, invalidDifferentType) {
     VALIDATOR;
-    ASSERT_EQ(nullptr, validator.isCalculValid(env->getType("int"), "+", env->getType("f32")));
+    ASSERT_EQ(nullptr, validator.isCalculValid(env->getType("int"), BinaryOperator::PLUS, env->getType("f32")));
 }
 
 TEST(CalculValidator, validNumeric) {
     VALIDATOR;
-    ASSERT_STREQ("i32", validator.isCalculValid(env->getType("i32"), "+", env->getType("i32"))->getName().c_str());
+    ASSERT_STREQ(
+        "i32", validator.isCalculValid(env->getType("i32"), BinaryOperator::PLUS, env->getType("i32"))->getName().c_str()
+    );
 }
 
 TEST(CalculValidator, validNumericComparison) {
     VALIDATOR;
-    ASSERT_STREQ("bool", validator.isCalculValid(env->getType("i32"), "==", env->getType("i32"))->getName().c_str());
+    ASSERT_STREQ(
+        "bool",
+        validator.isCalculValid(env->getType("i32"), BinaryOperator::EQEQ, env->getType("i32"))->getName().c_str()
+    );
+}
+
+TEST(CalculValidator, invalidNumericOperator) {
+    VALIDATOR;
+    ASSERT_EQ(nullptr, validator.isCalculValid(env->getType("f64"), BinaryOperator::AND, env->getType("f64")));
 }
 
 TEST(CalculValidator, validBool) {
     VALIDATOR;
-    ASSERT_STREQ("bool", validator.isCalculValid(env->getType("bool"), "&&", env->getType("bool"))->getName().c_str());
+    ASSERT_STREQ(
+        "bool",
+        validator.isCalculValid(env->getType("bool"), BinaryOperator::AND, env->getType("bool"))->getName().c_str()
+    );
+}
+
+TEST(CalculValidator, invalidBoolOperator) {
+    VALIDATOR;
+    ASSERT_EQ(nullptr, validator.isCalculValid(env->getType("bool"), BinaryOperator::PLUS, env->getType("bool")));
 }
 
 TEST(CalculValidator, validPointer) {
@@ -56,9 +76,9 @@ TEST(CalculValidator, validPointer) {
         "bool",
         validator
             .isCalculValid(
-                std::make_shared<filc::PointerType>(env->getType("i32")),
-                "==",
-                std::make_shared<filc::PointerType>(env->getType("i32"))
+                env->getPointerType(env->getType("i32")),
+                BinaryOperator::EQEQ,
+                env->getPointerType(env->getType("i32"))
             )
             ->getName()
             .c_str()
@@ -66,15 +86,30 @@ TEST(CalculValidator, validPointer) {
 
     ASSERT_STREQ(
         "bool*",
-        validator.isCalculValid(std::make_shared<filc::PointerType>(env->getType("bool")), "+", env->getType("i32"))
+        validator.isCalculValid(env->getPointerType(env->getType("bool")), BinaryOperator::PLUS, env->getType("i32"))
             ->getName()
             .c_str()
     );
 }
 
+TEST(CalculValidator, invalidPointer) {
+    VALIDATOR;
+    ASSERT_EQ(
+        nullptr,
+        validator.isCalculValid(env->getPointerType(env->getType("i32")), BinaryOperator::PLUS, env->getType("f32"))
+    );
+    ASSERT_EQ(
+        nullptr,
+        validator.isCalculValid(env->getPointerType(env->getType("i32")), BinaryOperator::MINUS, env->getType("i32"))
+    );
+}
+
 TEST(CalculValidator, invalidUnknown) {
     VALIDATOR;
     ASSERT_EQ(
-        nullptr, validator.isCalculValid(std::make_shared<filc::Type>("foo"), "+", std::make_shared<filc::Type>("foo"))
+        nullptr,
+        validator.isCalculValid(
+            std::make_shared<filc::Type>("foo"), BinaryOperator::PLUS, std::make_shared<filc::Type>("foo")
+        )
     );
 }
@@ -0,0 +1,178 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2025-Present Kevin Traini
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "test_tools.h"
+
+#include <filc/grammar/program/Program.h>
+#include <filc/grammar/variable/Variable.h>
+#include <filc/validation/ValidationVisitor.h>
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+#include <llvm/ADT/SmallString.h>
+#include <llvm/ADT/StringExtras.h>
+
+using namespace ::testing;
+
+#define VALIDATE(content)                          \
+    std::stringstream ss;                          \
+    filc::Diagnostics diagnostics(ss);             \
+    filc::ValidationVisitor visitor(diagnostics);  \
+    const auto program = parseString(content);     \
+    program->acceptVoidVisitor(&visitor);          \
+    diagnostics.flush();                           \
+    const auto output = std::string(std::istreambuf_iterator(ss), {})
+
+auto folded(const filc::ValidationVisitor &visitor, const filc::Expression *expression) -> std::string {
+    const auto constant = visitor.getEnvironment()->getConstant(expression);
+    if (constant == nullptr) {
+        return "not folded";
+    }
+    if (constant->isInteger()) {
+        return llvm::toString(constant->getInteger(), 10, expression->getType()->getTraits().is_signed_int);
+    }
+    if (constant->isFloat()) {
+        llvm::SmallString<16> result;
+        constant->getFloat().toString(result);
+        return result.str().str();
+    }
+    return "address";
+}
+
+auto foldedLast(const filc::ValidationVisitor &visitor, const filc::Program *program) -> std::string {
+    return folded(visitor, program->getExpressions().back());
+}
+
+TEST(ConstantEvaluator, integer_precedence) {
+    VALIDATE("2 + 3 * 4");
+    ASSERT_THAT(output, IsEmpty());
+    ASSERT_EQ("14", foldedLast(visitor, program.get()));
+}
+
+TEST(ConstantEvaluator, integer_unsigned) {
+    VALIDATE("val a: u8 = 200\nval b: u8 = 9\na / b * b + a % b");
+    ASSERT_THAT(output, IsEmpty());
+    ASSERT_EQ("200", foldedLast(visitor, program.get()));
+}
+
+TEST(ConstantEvaluator, integer_signed) {
+    VALIDATE("val a: i8 = 200\nval b: i8 = 9\na / b");
+    ASSERT_THAT(output, HasSubstr("Integer value does not fit in its type, it is truncated"));
+    ASSERT_FALSE(visitor.hasError());
+    ASSERT_EQ("-6", foldedLast(visitor, program.get())); // 200 is -56 as i8, division truncates toward 0
+}
+
+TEST(ConstantEvaluator, integer_signedModulo) {
+    VALIDATE("val a: i8 = 200\nval b: i8 = 9\na % b");
+    ASSERT_EQ("-2", foldedLast(visitor, program.get()));
+}
+
+TEST(ConstantEvaluator, integer_wrap) {
+    VALIDATE("val a: u8 = 200\nval b: u8 = 100\na + b");
+    ASSERT_THAT(output, HasSubstr("Result does not fit in its type, it wraps around"));
+    ASSERT_FALSE(visitor.hasError());
+    ASSERT_EQ("44", foldedLast(visitor, program.get()));
+}
+
+TEST(ConstantEvaluator, integer_128) {
+    VALIDATE("val a: i128 = 2147483647\na * a * a * a");
+    ASSERT_THAT(output, IsEmpty());
+    ASSERT_EQ("21267647892944572736998860269687930881", foldedLast(visitor, program.get()));
+}
+
+TEST(ConstantEvaluator, integer_divisionByZero) {
+    VALIDATE("1 % (2 - 2)");
+    ASSERT_THAT(output, HasSubstr("Division by zero"));
+    ASSERT_TRUE(visitor.hasError());
+}
+
+TEST(ConstantEvaluator, integer_divisionOverflow) {
+    VALIDATE("val min = 2147483647 + 1\nmin / (0 - 1)");
+    ASSERT_THAT(output, HasSubstr("by -1 overflows"));
+    ASSERT_TRUE(visitor.hasError());
+}
+
+TEST(ConstantEvaluator, float_f32) {
+    VALIDATE("val a: f32 = 0.1\nval b: f32 = 0.2\nval c: f32 = 0.3\na + b == c");
+    ASSERT_THAT(output, IsEmpty());
+    ASSERT_EQ("1", foldedLast(visitor, program.get()));
+}
+
+TEST(ConstantEvaluator, float_f64) {
+    VALIDATE("0.1 + 0.2 == 0.3");
+    ASSERT_THAT(output, IsEmpty());
+    ASSERT_EQ("0", foldedLast(visitor, program.get()));
+}
+
+TEST(ConstantEvaluator, float_value) {
+    VALIDATE("val a = 7.5 % 2.0\n0");
+    const auto variable = static_cast<filc::VariableDeclaration *>(program->getExpressions()[0]);
+    ASSERT_EQ("1.5", folded(visitor, variable->getValue()));
+}
+
+TEST(ConstantEvaluator, bool) {
+    VALIDATE("true && false || true");
+    ASSERT_THAT(output, IsEmpty());
+    ASSERT_EQ("1", foldedLast(visitor, program.get()));
+}
+
+TEST(ConstantEvaluator, pointer_differentAllocations) {
+    VALIDATE("val foo = 1\n&foo == &foo");
+    ASSERT_THAT(output, IsEmpty());
+    ASSERT_EQ("0", foldedLast(visitor, program.get()));
+}
+
+TEST(ConstantEvaluator, pointer_sameAllocation) {
+    VALIDATE("val foo = new i32(1)\nfoo == foo");
+    ASSERT_THAT(output, IsEmpty());
+    ASSERT_EQ("1", foldedLast(visitor, program.get()));
+}
+
+TEST(ConstantEvaluator, pointer_notConstantValue) {
+    VALIDATE("var foo = 1\nval bar = new i32(foo)\nbar == bar");
+    ASSERT_THAT(output, IsEmpty());
+    ASSERT_EQ("not folded", foldedLast(visitor, program.get()));
+}
+
+TEST(ConstantEvaluator, variable_notConstant) {
+    VALIDATE("var a = 2\na + 1");
+    ASSERT_THAT(output, IsEmpty());
+    ASSERT_EQ("not folded", foldedLast(visitor, program.get()));
+}
+
+TEST(ConstantEvaluator, arraySize_constant) {
+    VALIDATE("val size = 1 + 2\nval foo: i32[size] = [1, 2, 3]\nfoo[2]");
+    ASSERT_THAT(output, IsEmpty());
+    ASSERT_EQ("i32[3]", program->getExpressions()[1]->getType()->getDisplayName());
+}
+
+TEST(ConstantEvaluator, arraySize_notConstant) {
+    VALIDATE("var size = 3\nval foo: i32[size] = [1, 2, 3]\n0");
+    ASSERT_THAT(output, HasSubstr("Size of an array must be a constant integer: size"));
+    ASSERT_TRUE(visitor.hasError());
+}
+
+TEST(ConstantEvaluator, arraySize_negative) {
+    VALIDATE("val size = 0 - 1\nval foo: i32[size] = []\n0");
+    ASSERT_THAT(output, HasSubstr("Size of an array must be between 0 and 2147483647, size is -1"));
+    ASSERT_TRUE(visitor.hasError());
+}
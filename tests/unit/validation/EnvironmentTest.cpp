@@ -56,6 +56,51 @@ TEST(Environment, Type) {
     ASSERT_STREQ("custom", env.getType("custom")->getName().c_str());
 }
 
+TEST(Environment, typeId) {
+    filc::Environment env;
+    ASSERT_NE(0, env.getType("i32")->getId());
+    ASSERT_EQ(env.getType("i32")->getId(), env.getType("int")->getId());
+    ASSERT_EQ(env.getType("u8")->getId(), env.getType("char")->getId());
+    ASSERT_NE(env.getType("i32")->getId(), env.getType("u32")->getId());
+    ASSERT_TRUE(env.getType("int") == env.getType("i32"));
+    ASSERT_TRUE(env.getType("i32") != env.getType("i64"));
+}
+
+TEST(Environment, typeTraits) {
+    filc::Environment env;
+    const auto &int_traits = env.getType("int")->getTraits();
+    ASSERT_TRUE(int_traits.is_signed_int);
+    ASSERT_FALSE(int_traits.is_unsigned_int);
+    ASSERT_EQ(32, int_traits.bit_width);
+
+    const auto &u128_traits = env.getType("u128")->getTraits();
+    ASSERT_TRUE(u128_traits.is_unsigned_int);
+    ASSERT_EQ(128, u128_traits.bit_width);
+
+    const auto &f32_traits = env.getType("f32")->getTraits();
+    ASSERT_TRUE(f32_traits.is_float);
+    ASSERT_FALSE(f32_traits.isInteger());
+    ASSERT_EQ(32, f32_traits.bit_width);
+
+    const auto &bool_traits = env.getType("bool")->getTraits();
+    ASSERT_TRUE(bool_traits.is_bool);
+    ASSERT_FALSE(bool_traits.isNumeric());
+
+    const auto &string_traits = env.getType("char*")->getTraits();
+    ASSERT_TRUE(string_traits.is_pointer);
+    ASSERT_EQ(env.getType("char").get(), string_traits.element_type);
+}
+
+TEST(Environment, getPointerType) {
+    filc::Environment env;
+    ASSERT_EQ(env.getType("char*").get(), env.getPointerType(env.getType("u8")).get());
+    ASSERT_FALSE(env.hasType("i32*"));
+    const auto &pointer_type = env.getPointerType(env.getType("i32"));
+    ASSERT_TRUE(env.hasType("i32*"));
+    ASSERT_EQ(pointer_type.get(), env.getPointerType(env.getType("int")).get());
+    ASSERT_THROW((void) env.getPointerType(std::make_shared<filc::Type>("custom")), std::logic_error);
+}
+
 TEST(Environment, Name) {
     filc::Environment env;
     ASSERT_FALSE(env.hasName("my_name"));
@@ -32,14 +32,16 @@
 
 using namespace ::testing;
 
-#define VISITOR           \
-    std::stringstream ss; \
-    filc::ValidationVisitor visitor(ss)
+#define VISITOR                        \
+    std::stringstream ss;              \
+    filc::Diagnostics diagnostics(ss); \
+    filc::ValidationVisitor visitor(diagnostics)
 
 TEST(ValidationVisitor, program_valid) {
     VISITOR;
     const auto program = parseString("0");
     program->acceptVoidVisitor(&visitor);
+    diagnostics.flush();
     ASSERT_THAT(std::string(std::istreambuf_iterator(ss), {}), IsEmpty());
     ASSERT_FALSE(visitor.hasError());
 }
@@ -48,6 +50,7 @@ TEST(ValidationVisitor, program_invalid) {
     VISITOR;
     const auto program = parseString("3.4");
     program->acceptVoidVisitor(&visitor);
+    diagnostics.flush();
     ASSERT_THAT(std::string(std::istreambuf_iterator(ss), {}), HasSubstr("Expected type int aka i32 but got f64"));
     ASSERT_TRUE(visitor.hasError());
 }
@@ -56,6 +59,7 @@ TEST(ValidationVisitor, program_finish_u8) {
     VISITOR;
     const auto program = parseString("val foo: u8 = 2\nfoo");
     program->acceptVoidVisitor(&visitor);
+    diagnostics.flush();
     ASSERT_THAT(std::string(std::istreambuf_iterator(ss), {}), IsEmpty());
     ASSERT_FALSE(visitor.hasError());
 }
@@ -64,6 +68,7 @@ TEST(ValidationVisitor, program_finish_bool) {
     VISITOR;
     const auto program = parseString("true");
     program->acceptVoidVisitor(&visitor);
+    diagnostics.flush();
     ASSERT_THAT(std::string(std::istreambuf_iterator(ss), {}), IsEmpty());
     ASSERT_FALSE(visitor.hasError());
 }
@@ -72,6 +77,7 @@ TEST(ValidationVisitor, boolean) {
     VISITOR;
     const auto program = parseString("true\n0");
     program->acceptVoidVisitor(&visitor);
+    diagnostics.flush();
     ASSERT_THAT(std::string(std::istreambuf_iterator(ss), {}), HasSubstr("Boolean value not used"));
     ASSERT_FALSE(visitor.hasError());
 }
@@ -80,15 +86,37 @@ TEST(ValidationVisitor, integer) {
     VISITOR;
     const auto program = parseString("2\n0");
     program->acceptVoidVisitor(&visitor);
+    diagnostics.flush();
     ASSERT_THAT(std::string(std::istreambuf_iterator(ss), {}), HasSubstr("Integer value not used"));
     ASSERT_FALSE(visitor.hasError());
     ASSERT_STREQ("int", program->getExpressions()[0]->getType()->getDisplayName().c_str());
 }
 
+TEST(ValidationVisitor, integer_warning_disabled) {
+    VISITOR;
+    diagnostics.disableWarning("unused-value");
+    const auto program = parseString("2\n0");
+    program->acceptVoidVisitor(&visitor);
+    diagnostics.flush();
+    ASSERT_THAT(std::string(std::istreambuf_iterator(ss), {}), IsEmpty());
+    ASSERT_FALSE(visitor.hasError());
+}
+
+TEST(ValidationVisitor, integer_warning_as_error) {
+    VISITOR;
+    diagnostics.setWarningsAsErrors(true);
+    const auto program = parseString("2\n0");
+    program->acceptVoidVisitor(&visitor);
+    diagnostics.flush();
+    ASSERT_THAT(std::string(std::istreambuf_iterator(ss), {}), HasSubstr("[ERROR] \x1B[0mInteger value not used"));
+    ASSERT_TRUE(visitor.hasError());
+}
+
 TEST(ValidationVisitor, float) {
     VISITOR;
     const auto program = parseString("3.14\n0");
     program->acceptVoidVisitor(&visitor);
+    diagnostics.flush();
     ASSERT_THAT(std::string(std::istreambuf_iterator(ss), {}), HasSubstr("Float value not used"));
     ASSERT_FALSE(visitor.hasError());
     ASSERT_STREQ("f64", program->getExpressions()[0]->getType()->getDisplayName().c_str());
@@ -98,6 +126,7 @@ TEST(ValidationVisitor, character) {
     VISITOR;
     const auto program = parseString("'a'\n0");
     program->acceptVoidVisitor(&visitor);
+    diagnostics.flush();
     ASSERT_THAT(std::string(std::istreambuf_iterator(ss), {}), HasSubstr("Character value not used"));
     ASSERT_FALSE(visitor.hasError());
     ASSERT_STREQ("char", program->getExpressions()[0]->getType()->getDisplayName().c_str());
@@ -107,6 +136,7 @@ TEST(ValidationVisitor, string) {
     VISITOR;
     const auto program = parseString("\"hello\"\n0");
     program->acceptVoidVisitor(&visitor);
+    diagnostics.flush();
     ASSERT_THAT(std::string(std::istreambuf_iterator(ss), {}), HasSubstr("String value not used"));
     ASSERT_FALSE(visitor.hasError());
     ASSERT_STREQ("char*", program->getExpressions()[0]->getType()->getDisplayName().c_str());
@@ -116,6 +146,7 @@ TEST(ValidationVisitor, variable_alreadyDefined) {
     VISITOR;
     const auto program = parseString("val my_constant = 2\nval my_constant = 3");
     program->acceptVoidVisitor(&visitor);
+    diagnostics.flush();
     ASSERT_THAT(std::string(std::istreambuf_iterator(ss), {}), HasSubstr("my_constant is already defined"));
     ASSERT_TRUE(visitor.hasError());
     ASSERT_STREQ("int", program->getExpressions()[0]->getType()->getDisplayName().c_str());
@@ -126,6 +157,7 @@ TEST(ValidationVisitor, variable_constantWithoutValue) {
     VISITOR;
     const auto program = parseString("val my_constant");
     program->acceptVoidVisitor(&visitor);
+    diagnostics.flush();
     ASSERT_THAT(
         std::string(std::istreambuf_iterator(ss), {}),
         HasSubstr("When declaring a constant, you must provide it a value")
@@ -138,6 +170,7 @@ TEST(ValidationVisitor, variable_unknowType) {
     VISITOR;
     const auto program = parseString("var my_var: foo");
     program->acceptVoidVisitor(&visitor);
+    diagnostics.flush();
     ASSERT_THAT(std::string(std::istreambuf_iterator(ss), {}), HasSubstr("Unknown type: foo"));
     ASSERT_TRUE(visitor.hasError());
     ASSERT_EQ(nullptr, program->getExpressions()[0]->getType());
@@ -147,6 +180,7 @@ TEST(ValidationVisitor, variable_differentValueType) {
     VISITOR;
     const auto program = parseString("var my_var: i32 = 'a'");
     program->acceptVoidVisitor(&visitor);
+    diagnostics.flush();
     ASSERT_THAT(
         std::string(std::istreambuf_iterator(ss), {}),
         HasSubstr("Cannot assign value of type char aka u8 to a variable of type i32")
@@ -159,6 +193,7 @@ TEST(ValidationVisitor, variable_assignAliasType) {
     VISITOR;
     const auto program = parseString("var my_var: u8 = 'a'\n0");
     program->acceptVoidVisitor(&visitor);
+    diagnostics.flush();
     ASSERT_THAT(std::string(std::istreambuf_iterator(ss), {}), IsEmpty());
     ASSERT_FALSE(visitor.hasError());
     ASSERT_STREQ("u8", program->getExpressions()[0]->getType()->getDisplayName().c_str());
@@ -168,6 +203,7 @@ TEST(ValidationVisitor, variable_withoutTypeAndValue) {
     VISITOR;
     const auto program = parseString("var my_var");
     program->acceptVoidVisitor(&visitor);
+    diagnostics.flush();
     ASSERT_THAT(
         std::string(std::istreambuf_iterator(ss), {}),
         HasSubstr("When declaring a variable, you must provide at least a type or a value")
@@ -180,6 +216,7 @@ TEST(ValidationVisitor, variable_valid) {
     VISITOR;
     const auto program = parseString("val foo: i32 = 45");
     program->acceptVoidVisitor(&visitor);
+    diagnostics.flush();
     ASSERT_THAT(std::string(std::istreambuf_iterator(ss), {}), IsEmpty());
     ASSERT_FALSE(visitor.hasError());
     ASSERT_STREQ("i32", program->getExpressions()[0]->getType()->getDisplayName().c_str());
@@ -189,6 +226,7 @@ TEST(ValidationVisitor, variable_castInteger) {
     VISITOR;
     const auto program = parseString("val bar: u8 = 4\n0");
     program->acceptVoidVisitor(&visitor);
+    diagnostics.flush();
     ASSERT_THAT(std::string(std::istreambuf_iterator(ss), {}), IsEmpty());
     ASSERT_FALSE(visitor.hasError());
     ASSERT_STREQ("u8", program->getExpressions()[0]->getType()->getDisplayName().c_str());
@@ -198,6 +236,7 @@ TEST(ValidationVisitor, identifier_nonExisting) {
     VISITOR;
     const auto program = parseString("bar");
     program->acceptVoidVisitor(&visitor);
+    diagnostics.flush();
     ASSERT_THAT(
         std::string(std::istreambuf_iterator(ss), {}), HasSubstr("Unknown name, don't know what it refers to: bar")
     );
@@ -209,6 +248,7 @@ TEST(ValidationVisitor, identifier_noValue) {
     VISITOR;
     const auto program = parseString("var foo : i32\nfoo");
     program->acceptVoidVisitor(&visitor);
+    diagnostics.flush();
     ASSERT_THAT(
         std::string(std::istreambuf_iterator(ss), {}),
         HasSubstr("Variable foo has no value, please set one before accessing it")
@@ -221,6 +261,7 @@ TEST(ValidationVisitor, identifier_validAssignation) {
     VISITOR;
     const auto program = parseString("var foo : i32\nfoo = 2\nfoo");
     program->acceptVoidVisitor(&visitor);
+    diagnostics.flush();
     ASSERT_THAT(std::string(std::istreambuf_iterator(ss), {}), IsEmpty());
     ASSERT_FALSE(visitor.hasError());
     ASSERT_STREQ("i32", program->getExpressions()[2]->getType()->getDisplayName().c_str());
@@ -230,6 +271,7 @@ TEST(ValidationVisitor, identifier_valid) {
     VISITOR;
     const auto program = parseString("val foo = 1\nfoo");
     program->acceptVoidVisitor(&visitor);
+    diagnostics.flush();
     ASSERT_THAT(std::string(std::istreambuf_iterator(ss), {}), IsEmpty());
     ASSERT_FALSE(visitor.hasError());
     ASSERT_STREQ("int", program->getExpressions()[1]->getType()->getDisplayName().c_str());
@@ -239,6 +281,7 @@ TEST(ValidationVisitor, calcul_invalidLeft) {
     VISITOR;
     const auto program = parseString("(val foo) + 2");
     program->acceptVoidVisitor(&visitor);
+    diagnostics.flush();
     ASSERT_THAT(
         std::string(std::istreambuf_iterator(ss), {}),
         HasSubstr("When declaring a constant, you must provide it a value")
@@ -251,6 +294,7 @@ TEST(ValidationVisitor, calcul_invalidRight) {
     VISITOR;
     const auto program = parseString("2 + (val foo)");
     program->acceptVoidVisitor(&visitor);
+    diagnostics.flush();
     ASSERT_THAT(
         std::string(std::istreambuf_iterator(ss), {}),
         HasSubstr("When declaring a constant, you must provide it a value")
@@ -263,6 +307,7 @@ TEST(ValidationVisitor, calcul_invalid) {
     VISITOR;
     const auto program = parseString("'a' && 3");
     program->acceptVoidVisitor(&visitor);
+    diagnostics.flush();
     ASSERT_THAT(
         std::string(std::istreambuf_iterator(ss), {}),
         HasSubstr("You cannot use operator && with char aka u8 and int aka i32")
@@ -275,15 +320,44 @@ TEST(ValidationVisitor, calcul_valid) {
     VISITOR;
     const auto program = parseString("2 + 2");
     program->acceptVoidVisitor(&visitor);
+    diagnostics.flush();
     ASSERT_THAT(std::string(std::istreambuf_iterator(ss), {}), IsEmpty());
     ASSERT_FALSE(visitor.hasError());
     ASSERT_STREQ("int", program->getExpressions()[0]->getType()->getDisplayName().c_str());
 }
 
+TEST(ValidationVisitor, calcul_longChain) {
+    VISITOR;
+    std::string content = "0";
+    for (int i = 0; i < 100000; i++) {
+        content += " + 1";
+    }
+    const auto program = parseString(content);
+    program->acceptVoidVisitor(&visitor);
+    diagnostics.flush();
+    ASSERT_THAT(std::string(std::istreambuf_iterator(ss), {}), IsEmpty());
+    ASSERT_FALSE(visitor.hasError());
+    ASSERT_STREQ("int", program->getExpressions()[0]->getType()->getDisplayName().c_str());
+}
+
+TEST(ValidationVisitor, calcul_invalidInChain) {
+    VISITOR;
+    const auto program = parseString("1 + 2 + 'a' + 3");
+    program->acceptVoidVisitor(&visitor);
+    diagnostics.flush();
+    ASSERT_THAT(
+        std::string(std::istreambuf_iterator(ss), {}),
+        HasSubstr("You cannot use operator + with int aka i32 and char aka u8")
+    );
+    ASSERT_TRUE(visitor.hasError());
+    ASSERT_EQ(nullptr, program->getExpressions()[0]->getType());
+}
+
 TEST(ValidationVisitor, assignation_nonExisting) {
     VISITOR;
     const auto program = parseString("foo = 3");
     program->acceptVoidVisitor(&visitor);
+    diagnostics.flush();
     ASSERT_THAT(
         std::string(std::istreambuf_iterator(ss), {}), HasSubstr("Unknown name, don't know what it refers to: foo")
     );
@@ -295,6 +369,7 @@ TEST(ValidationVisitor, assignation_constant) {
     VISITOR;
     const auto program = parseString("val foo = 3\nfoo = 4");
     program->acceptVoidVisitor(&visitor);
+    diagnostics.flush();
     ASSERT_THAT(std::string(std::istreambuf_iterator(ss), {}), HasSubstr("Cannot modify a constant"));
     ASSERT_TRUE(visitor.hasError());
     ASSERT_EQ(nullptr, program->getExpressions()[1]->getType());
@@ -304,6 +379,7 @@ TEST(ValidationVisitor, assignation_differentType) {
     VISITOR;
     const auto program = parseString("var foo = 3\nfoo = false");
     program->acceptVoidVisitor(&visitor);
+    diagnostics.flush();
     ASSERT_THAT(
         std::string(std::istreambuf_iterator(ss), {}),
         HasSubstr("Cannot assign value of type bool to a variable of type int aka i32")
@@ -316,6 +392,7 @@ TEST(ValidationVisitor, assignation_valid) {
     VISITOR;
     const auto program = parseString("var foo = 3\nfoo = 2");
     program->acceptVoidVisitor(&visitor);
+    diagnostics.flush();
     ASSERT_THAT(std::string(std::istreambuf_iterator(ss), {}), IsEmpty());
     ASSERT_FALSE(visitor.hasError());
     ASSERT_STREQ("int", program->getExpressions()[1]->getType()->getDisplayName().c_str());
@@ -325,6 +402,7 @@ TEST(ValidationVisitor, assignation_castInteger) {
     VISITOR;
     const auto program = parseString("var foo: u8 = 3\nfoo = 2\n0");
     program->acceptVoidVisitor(&visitor);
+    diagnostics.flush();
     ASSERT_THAT(std::string(std::istreambuf_iterator(ss), {}), IsEmpty());
     ASSERT_FALSE(visitor.hasError());
     ASSERT_STREQ("u8", program->getExpressions()[1]->getType()->getDisplayName().c_str());
@@ -334,6 +412,7 @@ TEST(ValidationVisitor, pointer_unknownType) {
     VISITOR;
     const auto program = parseString("new bla(2)");
     program->acceptVoidVisitor(&visitor);
+    diagnostics.flush();
     ASSERT_THAT(std::string(std::istreambuf_iterator(ss), {}), HasSubstr("Unknown type: bla"));
     ASSERT_TRUE(visitor.hasError());
     ASSERT_EQ(nullptr, program->getExpressions()[0]->getType());
@@ -343,6 +422,7 @@ TEST(ValidationVisitor, pointer_invalidValueType) {
     VISITOR;
     const auto program = parseString("new i32(true)");
     program->acceptVoidVisitor(&visitor);
+    diagnostics.flush();
     ASSERT_THAT(
         std::string(std::istreambuf_iterator(ss), {}),
         HasSubstr("Cannot assign a value of type bool to a pointer to type i32")
@@ -355,6 +435,7 @@ TEST(ValidationVisitor, pointer_notUsed) {
     VISITOR;
     const auto program = parseString("new i32(3);0");
     program->acceptVoidVisitor(&visitor);
+    diagnostics.flush();
     ASSERT_THAT(std::string(std::istreambuf_iterator(ss), {}), HasSubstr("Value not used"));
     ASSERT_FALSE(visitor.hasError());
     ASSERT_STREQ("i32*", program->getExpressions()[0]->getType()->getName().c_str());
@@ -364,6 +445,7 @@ TEST(ValidationVisitor, pointer_valid) {
     VISITOR;
     const auto program = parseString("val foo = new i32(3);0");
     program->acceptVoidVisitor(&visitor);
+    diagnostics.flush();
     ASSERT_THAT(std::string(std::istreambuf_iterator(ss), {}), IsEmpty());
     ASSERT_FALSE(visitor.hasError());
     ASSERT_STREQ("i32*", program->getExpressions()[0]->getType()->getName().c_str());
@@ -373,6 +455,7 @@ TEST(ValidationVisitor, pointerDereferencing_notAPointer) {
     VISITOR;
     const auto program = parseString("val foo = 'a';*foo");
     program->acceptVoidVisitor(&visitor);
+    diagnostics.flush();
     ASSERT_THAT(
         std::string(std::istreambuf_iterator(ss), {}), HasSubstr("Cannot dereference a variable which is not a pointer")
     );
@@ -383,6 +466,7 @@ TEST(ValidationVisitor, pointerDereferencing_valid) {
     VISITOR;
     const auto program = parseString("val foo = new i32(3);*foo");
     program->acceptVoidVisitor(&visitor);
+    diagnostics.flush();
     ASSERT_THAT(std::string(std::istreambuf_iterator(ss), {}), IsEmpty());
     ASSERT_FALSE(visitor.hasError());
     ASSERT_STREQ("i32", program->getExpressions()[1]->getType()->getName().c_str());
@@ -392,6 +476,7 @@ TEST(ValidationVisitor, variableAddress_valid) {
     VISITOR;
     const auto program = parseString("val foo = 2;val bar = &foo;*bar");
     program->acceptVoidVisitor(&visitor);
+    diagnostics.flush();
     ASSERT_THAT(std::string(std::istreambuf_iterator(ss), {}), IsEmpty());
     ASSERT_FALSE(visitor.hasError());
     ASSERT_STREQ("i32*", program->getExpressions()[1]->getType()->getName().c_str());
@@ -402,6 +487,7 @@ TEST(ValidationVisitor, array_differentType) {
     VISITOR;
     const auto program = parseString("[1, true];0");
     program->acceptVoidVisitor(&visitor);
+    diagnostics.flush();
     ASSERT_THAT(
         std::string(std::istreambuf_iterator(ss), {}), HasSubstr("All values of an array should be of the same type")
     );
@@ -412,6 +498,7 @@ TEST(ValidationVisitor, array_valid) {
     VISITOR;
     const auto program = parseString("val foo = [1, 2, 3];0");
     program->acceptVoidVisitor(&visitor);
+    diagnostics.flush();
     ASSERT_THAT(std::string(std::istreambuf_iterator(ss), {}), IsEmpty());
     ASSERT_FALSE(visitor.hasError());
     ASSERT_STREQ("i32[3]", program->getExpressions()[0]->getType()->getName().c_str());
@@ -421,8 +508,9 @@ TEST(ValidationVisitor, array_validFullSize) {
     VISITOR;
     const auto program = parseString("[[1, 2], [3, 4]];0");
     program->acceptVoidVisitor(&visitor);
+    diagnostics.flush();
     ASSERT_FALSE(visitor.hasError());
-    const auto array = std::dynamic_pointer_cast<filc::Array>(program->getExpressions()[0]);
+    const auto array = dynamic_cast<filc::Array *>(program->getExpressions()[0]);
     ASSERT_STREQ("i32[2][2]", array->getType()->getName().c_str());
     ASSERT_EQ(4, array->getFullSize());
 }
@@ -431,6 +519,7 @@ TEST(ValidationVisitor, array_validCast) {
     VISITOR;
     const auto program = parseString("val foo: i8[3] = [1, 2, 3];0");
     program->acceptVoidVisitor(&visitor);
+    diagnostics.flush();
     ASSERT_THAT(std::string(std::istreambuf_iterator(ss), {}), IsEmpty());
     ASSERT_FALSE(visitor.hasError());
     ASSERT_STREQ("i8[3]", program->getExpressions()[0]->getType()->getName().c_str());
@@ -440,6 +529,7 @@ TEST(ValidationVisitor, array_invalidCast) {
     VISITOR;
     const auto program = parseString("val foo: u32 = [1, 2, 3]");
     program->acceptVoidVisitor(&visitor);
+    diagnostics.flush();
     ASSERT_THAT(
         std::string(std::istreambuf_iterator(ss), {}),
         HasSubstr("Cannot cast an array to a type not corresponding to an array: u32")
@@ -451,6 +541,7 @@ TEST(ValidationVisitor, array_empty) {
     VISITOR;
     const auto program = parseString("[];0");
     program->acceptVoidVisitor(&visitor);
+    diagnostics.flush();
     ASSERT_THAT(std::string(std::istreambuf_iterator(ss), {}), HasSubstr("Value not used"));
     ASSERT_FALSE(visitor.hasError());
     ASSERT_STREQ("void[0]", program->getExpressions()[0]->getType()->getName().c_str());
@@ -460,6 +551,7 @@ TEST(ValidationVisitor, array_emptyCast) {
     VISITOR;
     const auto program = parseString("val foo: char[0] = [];0");
     program->acceptVoidVisitor(&visitor);
+    diagnostics.flush();
     ASSERT_THAT(std::string(std::istreambuf_iterator(ss), {}), IsEmpty());
     ASSERT_FALSE(visitor.hasError());
     ASSERT_STREQ("char[0]", program->getExpressions()[0]->getType()->getDisplayName().c_str());
@@ -469,6 +561,7 @@ TEST(ValidationVisitor, arrayAccess_unknownName) {
     VISITOR;
     const auto program = parseString("foo[0]");
     program->acceptVoidVisitor(&visitor);
+    diagnostics.flush();
     ASSERT_THAT(
         std::string(std::istreambuf_iterator(ss), {}), HasSubstr("Unknown name, don't know what it refers to: foo")
     );
@@ -479,6 +572,7 @@ TEST(ValidationVisitor, arrayAccess_notAnArray) {
     VISITOR;
     const auto program = parseString("val foo = 2;foo[0]");
     program->acceptVoidVisitor(&visitor);
+    diagnostics.flush();
     ASSERT_THAT(
         std::string(std::istreambuf_iterator(ss), {}), HasSubstr("Cannot access to offset on a variable of type int")
     );
@@ -489,6 +583,7 @@ TEST(ValidationVisitor, arrayAccess_outOfBound) {
     VISITOR;
     const auto program = parseString("val foo = [25];foo[5]");
     program->acceptVoidVisitor(&visitor);
+    diagnostics.flush();
     ASSERT_THAT(
         std::string(std::istreambuf_iterator(ss), {}),
         HasSubstr("Out of bound access to an array. Array has a size of 1")
@@ -500,6 +595,7 @@ TEST(ValidationVisitor, arrayAccess_valid) {
     VISITOR;
     const auto program = parseString("val foo = [1];foo[0]");
     program->acceptVoidVisitor(&visitor);
+    diagnostics.flush();
     ASSERT_THAT(std::string(std::istreambuf_iterator(ss), {}), IsEmpty());
     ASSERT_FALSE(visitor.hasError());
     ASSERT_STREQ("i32", program->getExpressions()[1]->getType()->getName().c_str());